@@ -0,0 +1,58 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file declares the hardware abstraction layer: everything WorldClock needs
+ * from the board beyond the Arduino core. hal_avr.cpp implements it on the
+ * Arduino, and host/hal_native.cpp implements it in memory for the Linux build.
+ */
+
+// build options
+//#define PROFILE						// build in the loop-phase probes and their debug serial dump
+
+// macros to simplify reading from PROGMEM arrays (plain memory off the AVR)
+#ifdef __AVR__
+#define LOADBYTE(x) (byte)pgm_read_byte_near(x)
+#define LOADINT(x) (int)pgm_read_word_near(x)
+#else
+#define LOADBYTE(x) (byte)(*(x))
+#define LOADINT(x) (int)(*(x))
+#endif
+
+// date/time attributes, shared with the RTC
+#define SZ_TIME		7		// must be equal to total number of indices below
+#define YEAR			0		// indices into the date/time array (must be sequential)
+#define MONTH			1
+#define DAY				2
+#define DOW				3
+#define HOUR			4
+#define MINUTE			5
+#define SECOND			6
+
+// provided by the HAL
+void halBegin();								// configure pins and start the LCD transmitter
+bool halColdStart();							// true if the board (and so the panels) just powered up
+void halTickBegin(void (*tick)());		// call tick() from an interrupt once a second
+void halTickTrim(long ppb);				// lengthen the tick by ppb parts per billion
+unsigned long halTickPhase();				// microseconds since the last tick; call with interrupts off
+void halTickRestart();						// start the current second over from now
+int halRtcSecond();							// read just the RTC's seconds; -1 if it isn't running
+bool halRtcRead(int* t);					// read the RTC into time fields; false if it isn't running
+void halRtcWrite(const int* t);			// set (and start) the RTC from time fields
+bool halButton(int button);				// true while the button (index from IO.h) is held
+void halButtonBegin(void (*change)());	// call change() from an interrupt when any button changes
+void halEepromRead(int addr, void* buf, int size);		// read a block of EEPROM
+void halEepromUpdate(int addr, const void* buf, int size);	// write a block, skipping unchanged bytes
+void halTxWait(int disp);					// called while waiting for room in a transmit queue
+void halTxStart();							// wake the transmitter after queueing bytes
+void halSleep();								// idle until an interrupt; call with interrupts off
+#ifdef PROFILE
+unsigned long halCycles();					// free-running count: CPU cycles (in steps of 64) on the AVR, ns on the host
+void halDebugBegin();						// open the debug serial port
+int halDebugRead();							// next byte received on the debug port, or -1
+void halDebugWrite(const char* str);		// send a string out of the debug port
+#endif
+
+// provided by WorldClock for the HAL
+int lcdNext(int disp);						// next byte queued for a display, or -1
@@ -6,16 +6,32 @@
  * This file contains the mapping of logical I/O channels to physical pin numbers.
  */
 
-// hold time in ms after each user interaction
-#define IODELAY	100
+// button timing, in ms: changes within IO_DEBOUNCE of the last accepted one are
+// bounce; a held button repeats after IO_REPEAT_FIRST, every IO_REPEAT_SLOW at
+// first, halving every IO_REPEAT_STEP repeats down to IO_REPEAT_FAST
+#define IO_DEBOUNCE		20
+#define IO_REPEAT_FIRST	400
+#define IO_REPEAT_SLOW	160
+#define IO_REPEAT_FAST	20
+#define IO_REPEAT_STEP	8
 
-// LCD outputs (and inputs, which must be mapped to unused pins)
+// LCD outputs (transmit only, driven by the Timer2 transmitter)
 #define LCD0_OUT	7
 #define LCD1_OUT	8
-#define LCD0_IN	6
-#define LCD1_IN	9
+#define LCD_BAUD	9600	// SerLCD baud rate, also the Timer2 tick rate
+#define TX_CMDIDLE	10		// bit times to idle after a SerLCD command (~1ms)
+#define LCD_WARMUP	500		// ms after power-on that a SerLCD shows its splash and ignores input
+#define LCD_SETTLE	250		// ms a SerLCD takes to store its backlight and splash settings
+#define DEBUG_BAUD	115200	// hardware serial (USB) rate for the PROFILE dump
+
+// DS1302 RTC 3-wire bus, on port C (A0-A2) so its port writes never race the
+// transmitter's writes to the LCD pins
+#define RTC_CE		14
+#define RTC_IO		15
+#define RTC_SCLK	16
 
 // input indices
+#define SZ_BUTTON	5
 #define UP		0
 #define DN		1
 #define DOWN	1
@@ -42,4 +58,8 @@ const int PRESS[] = {
 	0b10000};	// ok
 
 // macros for easier-to-read input polling
-#define PRESSED(x)	digitalRead(BUTTON[x])
+#define PRESSED(x)	halButton(x)
+
+// button events: the button index, flagged when generated by auto-repeat
+#define SZ_BTNQ		8
+#define BTN_REPEAT	0x80
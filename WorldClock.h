@@ -12,19 +12,65 @@
 #define SZ_LABEL		8		// number of characters to allow for labels (+1 for null terminator)
 #define TZ_LOCAL		0		// index of local time
 
-// date/time attributes
-#define SZ_TIME		7		// must be equal to total number of indices below
-#define YEAR			0		// indices into the date/time array (must be sequential)
-#define MONTH			1
-#define DAY				2
-#define DOW				3
-#define HOUR			4
-#define MINUTE			5
-#define SECOND			6
-
-// EEPROM memory locations for config values
-#define MEM_TZ			0x00	// Starting point for TZ indices
-#define MEM_LABEL		0x20	// starting point for timezone labels
+// epoch-seconds core: UTC is kept as seconds since 00:00:00 1 JAN of EPOCH_YEAR
+#define EPOCH_YEAR		0		// two-digit year of the epoch (2000)
+#define EPOCH_DOW		6		// day of the week on 1 JAN of EPOCH_YEAR (Saturday)
+#define SECS_DAY		86400L
+#define DAYS_MAR		60		// days from the epoch to 1 MAR 2000, where civil years start
+typedef uint32_t epoch_t;			// good until 2136, well past two-digit years
+
+// display attributes
+#define SZ_LCD			2		// number of 16x2 panels
+#define SZ_ROW			2		// rows per panel
+#define SZ_COL			16		// columns per panel
+#define LCD0			0		// indices of the panels
+#define LCD1			1
+#define LCD_MERGE		2		// most unchanged cells between changes resent rather than skipped with a cursor move
+#define SZ_TXQ			64		// bytes of transmit queue per panel (a full redraw fits; glyphs wait for room)
+#define LCD_SETUP		1		// bump when setSplash() or setBacklight() send something new
+
+// boot phases, as indices into bootTime[] (micros() since reset)
+#define SZ_BOOT			5
+#define BOOT_CLOCK		0		// clock read from the RTC, config loaded
+#define BOOT_FRAME		1		// first frame composed
+#define BOOT_READY		2		// panels ready to listen
+#define BOOT_QUEUED		3		// first frame queued to the panels
+#define BOOT_SENT		4		// first frame sent (the loop sees the queues empty)
+
+// EEPROM config store: copies of configRecord in a ring of slots, the newest valid one wins
+#define CFG_BASE		0x000	// address of the first slot
+#define CFG_EEPROM		1024	// bytes of EEPROM (ATmega328P)
+#define CFG_MAGIC		0xC7	// first byte of every record
+#define CFG_VERSION		2		// bump when configRecord changes; other versions load as defaults
+#define CFG_HOLDOFF		300L	// seconds a change waits before it is saved, so a burst costs one write
+
+// loop-phase probes, built in by PROFILE (HAL.h) and otherwise compiled to nothing
+#define SZ_PROBE			7
+#define PROBE_INPUT		0		// button polling and handling
+#define PROBE_RTC			1		// RTC writes and reads
+#define PROBE_TIME		2		// utc copy under noInterrupts(), DST and duty updates
+#define PROBE_SNAPSHOT	3		// zone conversions
+#define PROBE_COMPOSE		4		// field formatting
+#define PROBE_FLUSH		5		// glyphs and frame differences queued to the panels
+#define PROBE_LOOP		6		// one whole pass of the loop, sleep excluded
+#define SZ_HIST			10		// latency buckets: under PROBE_BASE cycles, then doubling
+#define PROBE_BASE		128
+#ifdef PROFILE
+#define PROBE_START(p)	unsigned long probe##p = halCycles()
+#define PROBE_STOP(p)		probeRecord(p, halCycles() - probe##p)
+#else
+#define PROBE_START(p)
+#define PROBE_STOP(p)
+#endif
+
+// calibration of the tick against the RTC
+#define CAL_WINDOW		8000UL		// us either side of a tick to look for the RTC's second, once aligned
+#define CAL_MAX			64				// most minutes between RTC reads, once the trim has settled
+#define CAL_SETTLED		500L			// ppb of measured drift below which reads become rarer
+#define CAL_COARSE		100000L		// ppb of drift worth correcting from a coarse alignment
+#define CAL_GAIN			2				// share (1/n) of each finely measured drift applied to the trim
+#define CAL_LIMIT		10000000L	// ppb either way the trim may reach (a ceramic resonator's 1%)
+#define CAL_SAVE			100L			// ppb the trim must move before it is written to EEPROM
 
 // special display characters
 #define SYM_DST		0xEB	// superscript X
@@ -39,8 +85,8 @@
 #define ON	true
 #define OFF false
 
-// number-to-text mappings
-const char* DOW_NAME[] = {
+// number-to-text mappings, in flash
+const char DOW_NAME[][4] PROGMEM = {
 	"Sun",
 	"Mon",
 	"Tue",
@@ -49,7 +95,7 @@ const char* DOW_NAME[] = {
 	"Fri",
 	"Sat" };
 
-const char* MON_NAME[] = {
+const char MON_NAME[][4] PROGMEM = {
 	"   ",
 	"JAN",
 	"FEB",
@@ -64,6 +110,19 @@ const char* MON_NAME[] = {
 	"NOV",
 	"DEC" };
 
+// 00 to 99 as pairs of digits, for fmt2()
+const char DIGIT_PAIR[] PROGMEM =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
 const int SZ_MONTH[] = {
 	31, // december, rolled over
 	31,
@@ -79,19 +138,117 @@ const int SZ_MONTH[] = {
 	30,
 	31 };
 
+// local date/time of one timezone, as captured by takeSnapshot()
+struct zoneSnap {
+	byte year, month, day, dow, hour, minute;
+	unsigned int days;	// days since the epoch, for comparing dates between zones
+	bool dst;
+};
+
+// a place in one timezone's TZ_TRANS records, so converting utc is a compare until the
+// next transition comes round; seekZone() starts it at the epoch
+struct zoneCursor {
+	byte zone;					// timezone the cursor is in
+	unsigned int next;		// offset in TZ_TRANS of the next state byte
+	epoch_t from, until;		// utc span the state below holds for
+	signed char quarters;	// total offset from UTC, in quarter hours
+	bool dst;
+	bool rules;					// past the last record: the zone's DS_* rules apply
+};
+
+#ifdef PROFILE
+// what one probe has seen since the last reset
+struct probeStat {
+	unsigned long count, min, max;
+	unsigned long total, runs;		// for the mean: both halve whenever total would overflow
+	unsigned int hist[SZ_HIST];
+};
+
+const char PROBE_NAME[SZ_PROBE][9] PROGMEM = { "input", "rtc", "time", "snapshot", "compose", "flush", "loop" };
+const char BOOT_NAME[SZ_BOOT][9] PROGMEM = { "boot clk", "boot frm", "boot rdy", "boot que", "boot snt" };
+#endif
+
+// everything kept across power cycles, saved as one record with a CRC
+struct configRecord {
+	byte magic, version;
+	uint16_t seq;							// save count; the slot with the highest is current
+	int32_t trim;							// Timer1 tick trim, ppb
+	byte tz[SZ_TZ];
+	char label[SZ_TZ][SZ_LABEL];
+	byte view;
+	byte lcdSetup;						// LCD_SETUP the panels' stored splash and backlight match
+	uint16_t crc;							// CRC-16/CCITT of everything above
+};
+#define CFG_SLOTS		((CFG_EEPROM - CFG_BASE) / sizeof(configRecord))
+static_assert(CFG_SLOTS >= 2 && CFG_SLOTS <= 16, "the config ring needs 2 to 16 slots");
+
+// defaults for a blank or corrupt EEPROM
+const byte CFG_DEFAULT_TZ[SZ_TZ] PROGMEM = { TZ_PST, TZ_JST, TZ_HST, TZ_EST, TZ_CET, TZ_CET, TZ_ARST };
+const char CFG_DEFAULT_LABEL[SZ_TZ][SZ_LABEL] PROGMEM = { "Calif", "Japan", "Hawaii", "Wash DC", "Spain", "Italy", "Bahrain" };
+
 // function prototypes
 void updateDisp(bool refresh = false);
+void composeFrame();
+void selectView(byte v);
 void updateTime();
-void utcToLocal(int tznum);
-void localToUtc(int tznum);
-void normalizeDateTime(int* minute, int* hour, int* dow, int* day, int* month, int* year);
-void normalizeDate(int* dow, int* day, int* month, int* year);
-bool isDst(int tznum);
-bool isNextDay(int tznum);
-bool isPrevDay(int tznum);
-void printAt(SoftwareSerial &disp, int row, int col, const char *str);
-void moveCursor(SoftwareSerial &disp, int row, int col);
-void clearScreen(SoftwareSerial &disp);
-void setSplash(SoftwareSerial &disp);
-void setBacklight(SoftwareSerial &disp, bool state);
+void setRealtime(epoch_t secs);
+void syncRtc();
+void alignRtc(epoch_t soft, unsigned long phase, bool fine);
+void loadConfig();
+void defaultConfig();
+void markConfig();
+void saveConfig();
+unsigned int configCrc(const configRecord* cfg);
+void writeRtc();
+void updateDuty();
+void handleButton(int event);
+void buttonChange();
+void debounceButton(int b, unsigned long now);
+void pollButtons();
+void queueButton(byte event);
+int nextButton();
+epoch_t encodeTime(const int* t);
+void decodeTime(epoch_t secs, int* t);
+unsigned int daysFromCivil(int year, int month, int day);
+void civilFromDays(unsigned int days, int* t);
+long tzOffset(int tznum);
+char* tzName(int tznum, char* buf, int size);
+char* tzLocation(int tznum, char* buf, int size);
+char* poolString(unsigned int offset, char* buf, int size);
+bool isLeap(int year);
+int monthDays(int month, int year);
+long zoneOffset(int tznum, zoneCursor* zc, bool* dst);
+void seekZone(int tznum, zoneCursor* zc);
+void stepZone(zoneCursor* zc);
+bool isDstAt(int tznum, epoch_t local);
+void updateDst();
+epoch_t dsTransition(int year, int month, int week, int dow, int day);
+void takeSnapshot();
+void snapZone(int tznum, zoneSnap* zs, zoneCursor* zc);
+const zoneSnap* boundSnap(byte zone);
+char daySymbol(const zoneSnap* zs);
+char dstSymbol(const zoneSnap* zs);
+char* fmtChar(char* out, const char* end, char c);
+char* fmt2(char* out, const char* end, byte v);
+char* fmtName(char* out, const char* end, const char* name);
+char* fmtTime(char* out, const char* end, const zoneSnap* zs, char suffix);
+#ifdef PROFILE
+char* fmtNum(char* out, const char* end, unsigned long v, int width);
+void probeRecord(byte probe, unsigned long cycles);
+void probeReset();
+void probeDump();
+void probeFigure(const char* name, unsigned long v);
+void probePoll();
+#endif
+void printBig(int disp, int column, const zoneSnap* zs);
+byte loadGlyphs();
+void flushPanels();
+void flushDisp(int disp);
+void moveCursor(int disp, int row, int col);
+void clearScreen(int disp);
+void setSplash(int disp);
+void setBacklight(int disp, bool state);
+void lcdWrite(int disp, byte b);
+void lcdPrint_P(int disp, const char* str);
+byte lcdDepth(int disp);
 
@@ -4,153 +4,212 @@
  * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
  *
  * Setup requires configuring the serial port as needed by the SerLCD backpack,
- * getting the current time from the RTC, and setting the initial configurable
- * variables (such as timezones to display) from the internal EEPROM.
+ * getting the current time from the DS1302 RTC, and setting the initial
+ * configurable variables (such as timezones to display) from the internal EEPROM.
  *
- * Input handling is performed in the main loop. Updates from the RTC trigger an
- * interrupt handler, and display updates are triggered asynchronously via flag.
+ * Button changes raise a pin-change interrupt that debounces them and queues
+ * events, which the main loop handles (adding auto-repeats) without ever waiting.
+ * A one-second tick interrupt counts time between once-a-minute RTC reads, and
+ * display updates are triggered asynchronously via flag. Once a pass of the loop
+ * finds nothing left to do, the MCU idles until the next interrupt; dutyCycle
+ * tracks how much of each second it spends awake.
  */
 
-#include <SoftwareSerial.h>
-#include <EEPROM.h>
+#include "HAL.h"
 #include "timezones.h"
 #include "WorldClock.h"
+#include "dstables.h"
+#include "layouts.h"
 #include "IO.h"
-// FIXME-RTC: for RTC simulation only
-#include <TimerOne.h>
 
 // GLOBAL VARIABLES
 
 // persistent tracking of selected timezone data
 int tz[SZ_TZ];
-bool tzDst[SZ_TZ], tzNext[SZ_TZ], tzPrev[SZ_TZ];
 char tzLabel[SZ_TZ][SZ_LABEL];
 
-// current date/time in UTC
-volatile int realtime[SZ_TIME];		// updated by interrupt
-int time[SZ_TIME];						// copied from realtime[] outside of interrupt
+#ifdef PROFILE
+// loop-phase probes, and ticks that came in while a frame was still being rendered
+probeStat probes[SZ_PROBE];
+volatile unsigned int probeOverruns = 0;
+volatile bool fRendering = false;
+#endif
+
+// time each boot phase ended, as micros() since reset (see BOOT_*)
+unsigned long bootTime[SZ_BOOT];
+
+// the config as last loaded or saved, and changes waiting to be saved
+configRecord config;
+byte cfgSlot = 0;							// slot config came from or went to
+bool fSaveConfig = false;				// tz, labels, view or trim changed since
+unsigned long cfgChanged = 0;			// millis() of the first unsaved change
+
+// per-tick snapshot of every selected timezone (and UTC), converted once per update
+zoneSnap snap[SZ_TZ];
+zoneSnap snapUtc;
+zoneCursor snapCursor[SZ_TZ];			// each snapshot's place in its zone's transitions
+zoneCursor utcCursor;
+
+// current date/time in UTC, as seconds since the epoch
+volatile epoch_t realtime;				// updated by interrupt
+volatile byte rtSecond;					// realtime % 60, counted alongside it so the tick needn't divide
+epoch_t utc;								// copied from realtime outside of interrupt
 volatile bool fUpdateTime = false;	// trigger copy in main loop
-int ltime[SZ_TIME];						// synced to/from time[] when requested
+volatile bool fSyncRtc = false;		// an RTC read is due at the coming minute boundary
+bool fWriteRtc = false;					// realtime was adjusted: write it to the RTC
+unsigned long rtcBusMicros = 0;		// duration of the last RTC read (3-wire transaction)
+
+// calibration of the Timer1 tick against the RTC's second
+long tickTrim = 0;						// ppb the tick is lengthened by
+long trimSaved = 0;						// tickTrim as last written to EEPROM
+bool calAligned = false;				// the tick was last lined up within CAL_WINDOW of the RTC
+bool calFine = false;					// ...and to within a bus read, not a pass of the loop
+int calSecond = -1;						// RTC seconds seen while waiting for them to change
+epoch_t calLast = 0;						// RTC time of the last alignment, 0 for none
+long calOffset = 0;						// clock minus RTC found by the last read, in us
+byte calInterval = 1;					// minutes between RTC reads
+volatile byte calDue = 1;				// minute boundaries until the next read
+
+// DST transitions for the current UTC year, per DS_* ruleset, in local standard time
+epoch_t dsStart[SZ_DS], dsFinish[SZ_DS];
+epoch_t dsYearStart = 0, dsYearEnd = 0;	// span of utc the transitions are valid for
 
 // display attributes
-bool heartbeat = false;
-bool primaryView = true;
+byte lcdSetup = 0;							// LCD_SETUP the panels' stored splash and backlight match
+byte view = VIEW_PRIMARY;				// index into LAYOUT_VIEW
+byte viewZones = 0;						// zones the view binds, as 1 << slot (ZONE_UTC included)
+byte viewGlyphs = 0;						// panels the view draws big digits on, as 1 << panel
+byte lcdGlyphs = 0;						// panels whose CGRAM holds BIG_GLYPH
+byte glyphNext[SZ_LCD];					// glyphs of an upload queued so far, per panel
 volatile bool fUpdateDisp = false;
 volatile bool fRedrawDisp = false;
 
-// display devices
-SoftwareSerial LCD0(LCD0_IN ,LCD0_OUT);
-SoftwareSerial LCD1(LCD1_IN, LCD1_OUT);
+// display transmit queues, filled by the renderer and drained by the Timer2 transmitter
+volatile byte txQueue[SZ_LCD][SZ_TXQ];
+volatile byte txHead[SZ_LCD], txTail[SZ_LCD];
+byte txHigh[SZ_LCD];						// high-water mark of each queue
+unsigned int txStalls = 0;				// writes that had to wait for a full queue
+
+// button state, debounced on each change by the pin-change interrupt and re-checked
+// by the main loop, which also generates auto-repeats
+volatile byte btnState = 0;				// debounced state, as PRESS[] masks
+unsigned long btnEdge[SZ_BUTTON];		// millis() of each button's last accepted change
+unsigned long btnRepeat[SZ_BUTTON];		// millis() a held button next repeats
+byte btnRepeats[SZ_BUTTON];				// repeats so far in the current hold
+volatile byte btnQueue[SZ_BTNQ];			// button events waiting for the main loop
+volatile byte btnHead = 0, btnTail = 0;
+
+// time the main loop spends asleep, and the share of the last tick it was awake
+unsigned long dutyStart = 0;				// micros() the current tick began
+unsigned long dutySlept = 0;				// microseconds asleep since then
+unsigned int dutyCycle = 1000;			// awake time over the last tick, per mille
+
+// shadow of what each panel currently shows, and the frame being composed for it
+char lcdShadow[SZ_LCD][SZ_ROW][SZ_COL];
+char lcdFrame[SZ_LCD][SZ_ROW][SZ_COL];
 
 // MANDATORY FUNCTIONS
 
 void setup() {
 	// configure hardware first
-	pinMode(BUTTON[UP], INPUT);
-	pinMode(BUTTON[DN], INPUT);
-	pinMode(BUTTON[LT], INPUT);
-	pinMode(BUTTON[RT], INPUT);
-	pinMode(BUTTON[OK], INPUT);
-	LCD0.begin(9600);
-	LCD1.begin(9600);
-
-	// backlight to max
-	setBacklight(LCD0, ON);
-	setBacklight(LCD1, ON);
-
-	// LCD needs time to settle
-	delay(250);
-
-	// configure splash screen
-	setSplash(LCD0);
-	setSplash(LCD1);
-	delay(250);
-
-	// FIXME-RTC: set clock vars from RTC
-	// FIXME-RTC: remove hardcoded values once RTC is online
-	time[YEAR] = 15;
-	time[MONTH] = 3;
-	time[DAY] = 7;
-	time[DOW] = 6;
-	time[HOUR] = 0;
-	time[MINUTE] = 30;
-	time[SECOND] = 55;
-	for (int t = 0; t < SZ_TIME; t++) realtime[t] = time[t];
-
-	// FIXME-RTC: setup one second timer
-	Timer1.initialize(1000000);
-	Timer1.attachInterrupt(updateTime);
-	Timer1.start();
-
-	// initialize timezone values
-	for (int t = 0; t < SZ_TZ; t++) {
-		tz[t] = EEPROM.read(MEM_TZ + t);
-		tzDst[t] = isDst(tz[t]);
-		tzNext[t] = isNextDay(tz[t]);
-		tzPrev[t] = isPrevDay(tz[t]);
-		for (int c = 0; c < SZ_LABEL; c++) {
-			tzLabel[t][c] = (char)EEPROM.read(MEM_LABEL + (t * SZ_LABEL) + c);
-		}
+	halBegin();
+	halButtonBegin(buttonChange);
+	#ifdef PROFILE
+	halDebugBegin();
+	probeReset();
+	#endif
+
+	// set the clock from the RTC, or start the RTC from a default if it lost power
+	int rt[SZ_TIME];
+	if (!halRtcRead(rt)) {
+		rt[YEAR] = 15;
+		rt[MONTH] = 3;
+		rt[DAY] = 7;
+		rt[HOUR] = 0;
+		rt[MINUTE] = 30;
+		rt[SECOND] = 55;
+		fWriteRtc = true;
+	}
+	utc = encodeTime(rt);
+	setRealtime(utc);
+	if (fWriteRtc) writeRtc();
+	updateDst();
+
+	// restore the zones, view and tick trim, or take the defaults if EEPROM holds no valid config
+	loadConfig();
+	bootTime[BOOT_CLOCK] = micros();
+
+	// the software tick counts seconds between RTC reads, trimmed by the last calibration
+	halTickTrim(tickTrim);
+	halTickBegin(updateTime);
+
+	// compose the first frame while the panels may still be starting up
+	for (int t = 0; t < SZ_TZ; t++) seekZone(tz[t], &snapCursor[t]);
+	seekZone(TZ_UTC, &utcCursor);
+	takeSnapshot();
+	composeFrame();
+	bootTime[BOOT_FRAME] = micros();
+
+	// panels that have just powered up show their own splash and ignore input until
+	// LCD_WARMUP; after a reset they are already listening. The SerLCD only receives,
+	// so there is no ready signal to poll: this wait, and LCD_SETTLE's, are fixed
+	if (halColdStart() && millis() < LCD_WARMUP) delay(LCD_WARMUP - millis());
+	bootTime[BOOT_READY] = micros();
+
+	// the panels keep their splash and backlight, so only send them when they change
+	// (or when OK is held at boot, for a replaced panel)
+	if (lcdSetup != LCD_SETUP || PRESSED(OK)) {
+		setBacklight(LCD0, ON);
+		setBacklight(LCD1, ON);
+		setSplash(LCD0);
+		setSplash(LCD1);
+		delay(LCD_SETTLE);
+		lcdSetup = LCD_SETUP;
+		markConfig();
 	}
 
-/* FIXME-CONFIG: sample values to load into EEPROM until runtime config is coded
- * Insert EEPROM.write() calls into last portion of setup() immediately prior to
- * the equivalent EEPROM.read() calls.
-	int tzload[SZ_TZ] = { 137, 69, 143, 130, 2, 2, 10};
-	int tznames[SZ_TZ][SZ_LABEL] = { "Calif", "Japan", "Hawaii", "Wash DC", "Spain", "Italy", "Bahrain"};
-		EEPROM.write(MEM_TZ + t, tzload[t]);
-			EEPROM.write(MEM_LABEL + (t * SZ_LABEL) + c, tznames[t][c]);
-*/
 	clearScreen(LCD0);
 	clearScreen(LCD1);
+	flushPanels();
+	bootTime[BOOT_QUEUED] = micros();
 }
 
 void loop() {
+	PROBE_START(PROBE_LOOP);
+
 	// handle inputs
-	if (PRESSED(OK)) {
-		if (primaryView) primaryView = false;
-		else primaryView = true;
-		fRedrawDisp = true;
-		delay(IODELAY);
-	}
-	if (PRESSED(RIGHT)) {
-		noInterrupts();
-		realtime[HOUR]++;
-		interrupts();
-		fUpdateDisp = true;
-		delay(IODELAY);
-	}
-	if (PRESSED(LEFT)) {
-		noInterrupts();
-		realtime[HOUR]--;
-		interrupts();
-		fUpdateDisp = true;
-		delay(IODELAY);
-	}
+	PROBE_START(PROBE_INPUT);
+	pollButtons();
+	for (int e = nextButton(); e >= 0; e = nextButton()) handleButton(e);
+	PROBE_STOP(PROBE_INPUT);
+	#ifdef PROFILE
+	probePoll();
+	#endif
 
-	if (PRESSED(DOWN)) {
-		noInterrupts();
-		realtime[MINUTE]++;
-		interrupts();
-		fUpdateDisp = true;
-		delay(IODELAY);
-	}
-	if (PRESSED(UP)) {
-		noInterrupts();
-		realtime[MINUTE]--;
-		interrupts();
-		fUpdateDisp = true;
-		delay(IODELAY);
+	// keep the RTC in step: write adjustments once the buttons are let go, and
+	// otherwise read it when due
+	if (fWriteRtc || fSyncRtc) {
+		PROBE_START(PROBE_RTC);
+		if (fWriteRtc && !btnState) writeRtc();
+		if (fSyncRtc && !fWriteRtc) syncRtc();
+		PROBE_STOP(PROBE_RTC);
 	}
 
 	// update non-volatile time
 	if (fUpdateTime) {
+		PROBE_START(PROBE_TIME);
 		noInterrupts();
-		for (int t = 0; t < SZ_TIME; t++) time[t] = realtime[t];
+		utc = realtime;
 		interrupts();
 		fUpdateTime = false;
+		updateDst();
+		updateDuty();
+		PROBE_STOP(PROBE_TIME);
 	}
 
+	// save settings once they have been left alone for a while
+	if (fSaveConfig && millis() - cfgChanged >= CFG_HOLDOFF * 1000UL) saveConfig();
+
 	// redraw display
 	if (fRedrawDisp) {
 		updateDisp(true);
@@ -161,339 +220,975 @@ void loop() {
 		updateDisp();
 		fUpdateDisp = false;
 	}
+	// go on with a glyph upload, and send the frame it held back once it has drained
+	if (viewGlyphs & ~lcdGlyphs) {
+		PROBE_START(PROBE_FLUSH);
+		flushPanels();
+		PROBE_STOP(PROBE_FLUSH);
+	}
 
-	// for stability
-	delay(1);
+	// note when the first frame has gone out
+	if (!bootTime[BOOT_SENT] && !(viewGlyphs & ~lcdGlyphs) && txHead[LCD0] == txTail[LCD0]
+		&& txHead[LCD1] == txTail[LCD1]) {
+		bootTime[BOOT_SENT] = micros();
+	}
+	PROBE_STOP(PROBE_LOOP);
+
+	// sleep until the next interrupt (a tick, a button, or Timer0's millisecond)
+	// unless one arrived while this pass was running
+	noInterrupts();
+	if (fUpdateTime || fUpdateDisp || fRedrawDisp || btnHead != btnTail) {
+		interrupts();
+		return;
+	}
+	unsigned long slept = micros();
+	halSleep();
+	dutySlept += micros() - slept;
 }
 
-// DATE/TIME FUNCTIONS
+// work out how much of the time since the last call the loop spent awake
+void updateDuty() {
+	unsigned long now = micros();
+	unsigned long ms = (now - dutyStart) / 1000;
+	if (ms) {
+		unsigned long asleep = dutySlept / ms;
+		dutyCycle = asleep < 1000 ? 1000 - asleep : 0;
+	}
+	dutyStart = now;
+	dutySlept = 0;
+}
 
-// get the current time and date from the RTC once a minute, just increment seconds otherwise
-// FIXME-RTC: stub will require replacement once the RTC is integrated.
-void updateTime() {
+// INPUT FUNCTIONS
+
+// act on one button event: OK toggles the view, the others adjust the clock
+void handleButton(int event) {
+	long step;
+	switch (event & ~BTN_REPEAT) {
+	case OK:
+		if (event & BTN_REPEAT) return;
+		selectView((view + 1) % SZ_VIEW);
+		fRedrawDisp = true;
+		markConfig();
+		return;
+	case RIGHT: step = 3600; break;
+	case LEFT: step = -3600; break;
+	case DOWN: step = 60; break;
+	case UP: step = -60; break;
+	default: return;
+	}
+	noInterrupts();
+	realtime += step;
+	interrupts();
+	// show the adjustment now rather than at the next tick
 	fUpdateTime = true;
 	fUpdateDisp = true;
+	fWriteRtc = true;
+}
 
-	// currently faking time using built-in timers, will be replaced with RTC reads
-	realtime[SECOND]++;
-	if (realtime[SECOND] > 59) {
-		realtime[SECOND] = 0;
-		realtime[MINUTE]++;
-	}
-	// once seconds-to-minutes is taken care of, use normalizeDateTime to fix the rest
-	int nminute = realtime[MINUTE], nhour = realtime[HOUR], ndow = realtime[DOW];
-	int nday = realtime[DAY], nmonth = realtime[MONTH], nyear = realtime[YEAR];
-	normalizeDateTime(&nminute, &nhour, &ndow, &nday, &nmonth, &nyear);
-	realtime[MINUTE] = nminute;
-	realtime[HOUR] = nhour;
-	realtime[DOW] = ndow;
-	realtime[DAY] = nday;
-	realtime[MONTH] = nmonth;
-	realtime[YEAR] = nyear;
-}
-
-// populate time[] by adjusting ltime[] into UTC
-void localToUtc(int tznum) {
-	if (tznum == TZ_UTC) {
-		for (int t = 0; t < SZ_TIME; t++) {
-			time[t] = ltime[t];
-		}
-		return;
+// pin-change interrupt: the first edge after a quiet IO_DEBOUNCE is accepted at
+// once, and the bounces behind it are ignored
+void buttonChange() {
+	unsigned long now = millis();
+	for (int b = 0; b < SZ_BUTTON; b++) debounceButton(b, now);
+}
+
+// accept a button's current level if it differs from its debounced state and the
+// last accepted change was long enough ago, queueing an event for a press
+void debounceButton(int b, unsigned long now) {
+	bool held = halButton(b);
+	if (held == ((btnState & PRESS[b]) != 0)) return;
+	if (now - btnEdge[b] < IO_DEBOUNCE) return;
+
+	btnEdge[b] = now;
+	btnState ^= PRESS[b];
+	if (held) {
+		queueButton(b);
+		btnRepeat[b] = now + IO_REPEAT_FIRST;
+		btnRepeats[b] = 0;
 	}
-	int udow = time[DOW], uday = time[DAY], umonth = time[MONTH], uyear = time[YEAR];
-	int umin = time[MINUTE] - LOADINT(TZ_MIN + tznum);
-	int uhour = time[HOUR] - LOADINT(TZ_HOUR + tznum);
-	if (isDst(tznum)) uhour--;
+}
 
-	normalizeDateTime(&umin, &uhour, &udow, &uday, &umonth, &uyear);
-	time[MINUTE] = umin;
-	time[HOUR] = uhour;
-	time[DOW] = udow;
-	time[DAY] = uday;
-	time[MONTH] = umonth;
-	time[YEAR] = uyear;
+// catch a level that settled during the debounce window (its edge was ignored) and
+// auto-repeat held buttons, faster the longer they are held
+void pollButtons() {
+	noInterrupts();
+	unsigned long now = millis();
+	for (int b = 0; b < SZ_BUTTON; b++) {
+		debounceButton(b, now);
+		if (!(btnState & PRESS[b]) || (long)(now - btnRepeat[b]) < 0) continue;
 
-	// last steps need to be copying time[] to realtime[], then setting RTC to realtime[]
+		queueButton(b | BTN_REPEAT);
+		unsigned int wait = IO_REPEAT_SLOW >> (btnRepeats[b] / IO_REPEAT_STEP);
+		if (wait < IO_REPEAT_FAST) wait = IO_REPEAT_FAST;
+		else btnRepeats[b]++;
+		btnRepeat[b] = now + wait;
+	}
+	interrupts();
+}
+
+// add an event to the button queue (interrupts must be off); drops it when full
+void queueButton(byte event) {
+	byte next = (btnHead + 1) % SZ_BTNQ;
+	if (next == btnTail) return;
+	btnQueue[btnHead] = event;
+	btnHead = next;
+}
+
+// next button event, or -1 if there are none
+int nextButton() {
+	if (btnTail == btnHead) return -1;
+	byte event = btnQueue[btnTail];
+	btnTail = (btnTail + 1) % SZ_BTNQ;
+	return event;
+}
+
+// DATE/TIME FUNCTIONS
+
+// one-second tick: count the second in software, asking the main loop to read
+// the RTC around the coming minute boundary when a read is due
+void updateTime() {
+	#ifdef PROFILE
+	if (fRendering) probeOverruns++;
+	#endif
+	fUpdateTime = true;
+	fUpdateDisp = true;
+
+	realtime++;
+	if (++rtSecond == 60) rtSecond = 0;
+	if (rtSecond == 59 && --calDue == 0) fSyncRtc = true;
+}
+
+// set realtime outright, and the seconds into the minute the tick counts with it
+void setRealtime(epoch_t secs) {
 	noInterrupts();
-	for (int t = 0; t < SZ_TIME; t++) realtime[t] = time[t];
+	realtime = secs;
+	rtSecond = secs % 60;
 	interrupts();
-	return;
 }
 
-// populate ltime[] by adjusting time[] into the provided timezone
-void utcToLocal(int tznum) {
-	if (tznum == TZ_UTC) {
-		for (int t = 0; t < SZ_TIME; t++) {
-			ltime[t] = time[t];
+// find the instant the RTC's second turns over. Once aligned it turns within
+// CAL_WINDOW of a tick, so poll the bus across that window; otherwise check once
+// per pass of the loop (Timer0 wakes it every millisecond) until it changes.
+void syncRtc() {
+	epoch_t soft;
+	unsigned long phase;
+	bool fine = calAligned;
+
+	if (calAligned) {
+		// the edge is due as the trimmed tick ends; if the tick ended first, it was missed
+		noInterrupts();
+		byte second = rtSecond;
+		phase = halTickPhase();
+		interrupts();
+		if (second != 59) {
+			calAligned = false;
+			return;
 		}
-		return;
+		if ((long)phase < 1000000L + tickTrim / 1000 - (long)CAL_WINDOW) return;
+		int first = halRtcSecond();
+		unsigned long start = micros();
+		for (;;) {
+			int s = halRtcSecond();
+			noInterrupts();
+			if (s != first) break;
+			interrupts();
+			if (micros() - start > 2 * CAL_WINDOW) {
+				// the RTC has drifted out of the window: fall back to the slow search
+				calAligned = false;
+				return;
+			}
+		}
+	}
+	else {
+		int s = halRtcSecond();
+		if (calSecond < 0 || s == calSecond) {
+			calSecond = s;
+			return;
+		}
+		noInterrupts();
 	}
 
-	int ldow = time[DOW], lday = time[DAY], lmonth = time[MONTH], lyear = time[YEAR];
-	int lmin = time[MINUTE] + LOADINT(TZ_MIN + tznum);
-	int lhour = time[HOUR] + LOADINT(TZ_HOUR + tznum);
+	// the second just turned: note where the tick was, and start a new one now
+	soft = realtime;
+	phase = halTickPhase();
+	halTickRestart();
+	interrupts();
+	calSecond = -1;
+	fSyncRtc = false;
+	calDue = calInterval;
+	alignRtc(soft, phase, fine);
+}
+
+// set the clock to the RTC second that just began. The clock's lead over the RTC
+// since the last alignment is the tick's drift. When both alignments were fine a
+// share of it goes into the trim; a coarse one (good to about a millisecond) only
+// corrects drift too large for the fine window, but corrects all of it.
+void alignRtc(epoch_t soft, unsigned long phase, bool fine) {
+	int t[SZ_TIME];
+	unsigned long start = micros();
+	bool valid = halRtcRead(t);
+	rtcBusMicros = micros() - start;
+	if (!valid) return;
+
+	epoch_t rtc = encodeTime(t);
+	setRealtime(rtc);
+	fUpdateTime = true;
+	fUpdateDisp = true;
 
-	// isDst requires an up-to-date ltime, so normalize and dump before calling
-	normalizeDateTime(&lmin, &lhour, &ldow, &lday, &lmonth, &lyear);
-	ltime[MINUTE] = lmin;
-	ltime[HOUR] = lhour;
-	ltime[DOW] = ldow;
-	ltime[DAY] = lday;
-	ltime[MONTH] = lmonth;
-	ltime[YEAR] = lyear;
+	// phase counts the oscillator's microseconds, as many to the trimmed second
+	long period = 1000000L + tickTrim / 1000;
+	if ((long)phase >= period) {
+		soft++;
+		phase -= period;
+	}
+	int32_t lead = (int32_t)(soft - rtc);
+	bool near = lead >= -1 && lead <= 1;
+	calOffset = near ? lead * period + (long)phase : 0;
 
-	if (isDst(tznum)) lhour++;
+	if (near && calLast && rtc > calLast) {
+		long span = rtc - calLast;
+		long drift = calOffset / span * 1000L + calOffset % span * 1000L / span;
+		bool precise = fine && calFine;
+		if (precise) tickTrim += drift / CAL_GAIN;
+		else if (labs(drift) >= CAL_COARSE) tickTrim += drift;
+		if (tickTrim > CAL_LIMIT) tickTrim = CAL_LIMIT;
+		if (tickTrim < -CAL_LIMIT) tickTrim = -CAL_LIMIT;
+		halTickTrim(tickTrim);
 
-	// then again afterward in case the shift caused lhour to overflow
-	normalizeDateTime(&lmin, &lhour, &ldow, &lday, &lmonth, &lyear);
-	ltime[MINUTE] = lmin;
-	ltime[HOUR] = lhour;
-	ltime[DOW] = ldow;
-	ltime[DAY] = lday;
-	ltime[MONTH] = lmonth;
-	ltime[YEAR] = lyear;
+		// read less often as the trim settles, and every minute again if it moves
+		if (precise && labs(drift) < CAL_SETTLED) {
+			if (calInterval < CAL_MAX) calInterval *= 2;
+			if (labs(tickTrim - trimSaved) >= CAL_SAVE) {
+				trimSaved = tickTrim;
+				markConfig();
+			}
+		}
+		else calInterval = 1;
+		calDue = calInterval;
+	}
+	calAligned = true;
+	calFine = fine;
+	calLast = rtc;
 }
 
-// Normalize date/time based on standard ruleset. This function is only able to
-// fully normalize date/times where each value is no more than one "decade" off
-// (for instance, the myhours value must fall in the range -24 < *myhour < 47).
-void normalizeDateTime(int* mymin, int* myhour,  int* mydow,  int* myday,  int* mymonth,  int* myyear) {
-	if (*mymin < 0) {
-		--*myhour;
-		*mymin += 60;
+
+// CONFIG FUNCTIONS
+
+// find the newest config slot whose record checks out, read it with one block read,
+// and apply it; a blank or corrupt EEPROM falls back to the defaults
+void loadConfig() {
+	uint16_t rejected = 0;
+	for (;;) {
+		// the headers (everything before trim) alone pick the candidate, newest by
+		// sequence (which may wrap)
+		int best = -1;
+		uint16_t bestSeq = 0;
+		for (unsigned int s = 0; s < CFG_SLOTS; s++) {
+			configRecord head;
+			if (rejected & (1 << s)) continue;
+			halEepromRead(CFG_BASE + s * sizeof(configRecord), &head, offsetof(configRecord, trim));
+			if (head.magic != CFG_MAGIC || head.version != CFG_VERSION) continue;
+			if (best < 0 || (int16_t)(head.seq - bestSeq) > 0) {
+				best = s;
+				bestSeq = head.seq;
+			}
+		}
+		if (best < 0) {
+			defaultConfig();
+			break;
+		}
+		halEepromRead(CFG_BASE + best * sizeof(configRecord), &config, sizeof(configRecord));
+		if (config.crc == configCrc(&config)) {
+			cfgSlot = best;
+			break;
+		}
+		rejected |= 1 << best;
 	}
-	else if (*mymin > 59) {
-		++*myhour;
-		*mymin -= 60;
+
+	for (int t = 0; t < SZ_TZ; t++) {
+		tz[t] = config.tz[t] < SZ_ZONES ? config.tz[t] : TZ_UTC;
+		memcpy(tzLabel[t], config.label[t], SZ_LABEL);
+		tzLabel[t][SZ_LABEL - 1] = 0;
 	}
+	tickTrim = trimSaved = (config.trim > CAL_LIMIT || config.trim < -CAL_LIMIT) ? 0 : config.trim;
+	selectView(config.view < SZ_VIEW ? config.view : VIEW_PRIMARY);
+	lcdSetup = config.lcdSetup;
+}
 
-	if (*myhour < 0) {
-		--*myday;
-		--*mydow;
-		*myhour += 24;
+// the built-in config, numbered so the first save lands in slot 0
+void defaultConfig() {
+	memset(&config, 0, sizeof(config));
+	config.magic = CFG_MAGIC;
+	config.version = CFG_VERSION;
+	memcpy_P(config.tz, CFG_DEFAULT_TZ, SZ_TZ);
+	memcpy_P(config.label, CFG_DEFAULT_LABEL, sizeof(config.label));
+	config.view = VIEW_PRIMARY;
+	config.crc = configCrc(&config);
+	cfgSlot = CFG_SLOTS - 1;
+}
+
+// note a change to the persistent settings; the loop saves it once CFG_HOLDOFF passes
+void markConfig() {
+	if (!fSaveConfig) cfgChanged = millis();
+	fSaveConfig = true;
+}
+
+// write the settings to the next slot in the ring, so each save wears a different
+// slot and a save cut short by a power loss leaves the previous one intact
+void saveConfig() {
+	configRecord next = config;
+	for (int t = 0; t < SZ_TZ; t++) {
+		next.tz[t] = tz[t];
+		memcpy(next.label[t], tzLabel[t], SZ_LABEL);
 	}
-	else if (*myhour > 23) {
-		++*myday;
-		++*mydow;
-		*myhour -= 24;
+	next.trim = trimSaved;
+	next.view = view;
+	next.lcdSetup = lcdSetup;
+	fSaveConfig = false;
+
+	// nothing that was saved has changed, so nothing needs writing
+	next.crc = configCrc(&next);
+	if (next.crc == config.crc && !memcmp(&next, &config, sizeof(config))) return;
+
+	next.seq++;
+	next.crc = configCrc(&next);
+	cfgSlot = (cfgSlot + 1) % CFG_SLOTS;
+	halEepromUpdate(CFG_BASE + cfgSlot * sizeof(configRecord), &next, sizeof(configRecord));
+	config = next;
+}
+
+// CRC-16/CCITT (polynomial 0x1021, initial 0xFFFF) of a record, less its CRC
+unsigned int configCrc(const configRecord* cfg) {
+	const byte* p = (const byte*)cfg;
+	uint16_t crc = 0xFFFF;
+	for (unsigned int i = 0; i < offsetof(configRecord, crc); i++) {
+		crc ^= (uint16_t)p[i] << 8;
+		for (int b = 0; b < 8; b++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
 	}
+	return crc;
+}
 
-	normalizeDate(mydow, myday, mymonth, myyear);
+// set the RTC to realtime
+void writeRtc() {
+	int t[SZ_TIME];
+	noInterrupts();
+	epoch_t now = realtime;
+	interrupts();
+	decodeTime(now, t);
+	halRtcWrite(t);
+	fWriteRtc = false;
+
+	// the RTC's second now starts wherever the write landed
+	calAligned = false;
+	calLast = 0;
+	calSecond = -1;
+	calDue = 1;
 }
 
-// like normalizeDateTime, but for date only
-void normalizeDate(int* mydow, int* myday, int* mymonth, int* myyear) {
-	int leapfactor = 0;
-	if ((*mymonth == 2) && (((*myyear % 4) == 0) && (*myyear % 100) != 0)) leapfactor = 1;
+// standard (non-DST) offset of the provided timezone from UTC, in seconds
+long tzOffset(int tznum) {
+	return (long)LOADINT(TZ_HOUR + tznum) * 3600 + LOADINT(TZ_MIN + tznum) * 60;
+}
 
-	if (*mydow < 0) *mydow += 7;
-	if (*mydow > 6) *mydow -= 7;
+// copy the full name of the provided timezone out of flash into buf
+char* tzName(int tznum, char* buf, int size) {
+	return poolString(LOADINT(TZ_NAME + tznum), buf, size);
+}
 
-	if (*myday < 1) {
-		--*mymonth;
-		if (*mymonth < 1) {
-			*mymonth += 12;
-			--*myyear;
-		}
-		// recalculate leapfactor since month changed
-		if ((*mymonth == 2) && (((*myyear % 4) == 0) && ((*myyear % 100) != 0))) leapfactor = 1;
-		*myday += (SZ_MONTH[*mymonth] + leapfactor);
+// copy the representative location of the provided timezone out of flash into buf
+char* tzLocation(int tznum, char* buf, int size) {
+	return poolString(LOADINT(TZ_LOC + tznum), buf, size);
+}
+
+// copy a TZ_POOL string into buf (truncating to size), following suffix codes
+char* poolString(unsigned int offset, char* buf, int size) {
+	const char* src = TZ_POOL + offset;
+	int n = 0;
+	while (n < size - 1) {
+		byte c = LOADBYTE(src++);
+		if (!c) break;
+		// a suffix code finishes the string with a shared suffix, which may chain on
+		if (c < ' ') src = TZ_POOL + LOADINT(TZ_SUFFIX + c - 1);
+		else buf[n++] = c;
 	}
+	buf[n] = '\0';
+	return buf;
+}
 
-	else if (*myday > (SZ_MONTH[*mymonth] + leapfactor)) {
-		++*mymonth;
-		if (*mymonth > 12) {
-			*mymonth -= 12;
-			++*myyear;
-		}
-		// recalculate leapfactor since month changed (but we need the previous month's size)
-		if (((*mymonth - 1) == 2) && (((*myyear % 4) == 0) && ((*myyear % 100) != 0))) leapfactor = 1;
-		*myday -= (SZ_MONTH[(*mymonth - 1)] + leapfactor);
+// convert broken-down date/time fields (DOW is ignored) into seconds since the
+// epoch. Fields must already be in range.
+epoch_t encodeTime(const int* t) {
+	epoch_t days = daysFromCivil(t[YEAR], t[MONTH], t[DAY]);
+	return days * SECS_DAY + (long)t[HOUR] * 3600 + t[MINUTE] * 60 + t[SECOND];
+}
+
+// convert seconds since the epoch into broken-down date/time fields
+void decodeTime(epoch_t secs, int* t) {
+	unsigned int days = secs / SECS_DAY;
+	long rem = secs % SECS_DAY;
+
+	t[SECOND] = rem % 60;
+	rem /= 60;
+	t[MINUTE] = rem % 60;
+	t[HOUR] = rem / 60;
+	t[DOW] = (days + EPOCH_DOW) % 7;
+	civilFromDays(days, t);
+}
+
+// days since the epoch of a date, in constant time. Years are counted from 1 MAR,
+// so each leap day ends its year and months from March on have a fixed pattern of
+// lengths; the epoch (2000) starts a 400-year cycle, so the century rules are plain
+// divisions. Only JAN and FEB 2000 fall before the first such year.
+unsigned int daysFromCivil(int year, int month, int day) {
+	if (year == EPOCH_YEAR && month <= 2) return (month - 1) * 31 + day - 1;
+	unsigned int y = year - EPOCH_YEAR - (month <= 2);
+	unsigned int doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	return DAYS_MAR + 365 * y + y / 4 - y / 100 + doy;
+}
+
+// year, month and day of a day since the epoch, in constant time (see daysFromCivil())
+void civilFromDays(unsigned int days, int* t) {
+	if (days < DAYS_MAR) {
+		t[YEAR] = EPOCH_YEAR;
+		t[MONTH] = days < 31 ? 1 : 2;
+		t[DAY] = days < 31 ? days + 1 : days - 30;
+		return;
 	}
+	// days since 1 MAR 2000 still fit 16 bits until 2179
+	unsigned int doe = days - DAYS_MAR;
+	unsigned int y = (doe - doe / 1460 + doe / 36524) / 365;
+	unsigned int doy = doe - (365 * y + y / 4 - y / 100);
+	unsigned int mp = (5 * doy + 2) / 153;
+	t[DAY] = doy - (153 * mp + 2) / 5 + 1;
+	t[MONTH] = mp < 10 ? mp + 3 : mp - 9;
+	t[YEAR] = EPOCH_YEAR + y + (t[MONTH] <= 2);
+}
+
+// Gregorian leap years, counted from 2000
+bool isLeap(int year) {
+	return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+// number of days in the provided month (1-12) of the provided year
+int monthDays(int month, int year) {
+	if (month == 2 && isLeap(year)) return SZ_MONTH[month] + 1;
+	return SZ_MONTH[month];
 }
 
-// determine if it is currently daylight savings time by deduction
-bool isDst(int tznum) {
+// total offset from UTC (seconds) of the provided timezone at utc, and whether it is
+// DST: from its TZ_TRANS records while they last, then from its DS_* rules. zc only
+// steps forward as utc does, so this is a compare unless utc moved back or a
+// transition came round
+long zoneOffset(int tznum, zoneCursor* zc, bool* dst) {
+	if (zc->zone != tznum || utc < zc->from) seekZone(tznum, zc);
+	while (!zc->rules && utc >= zc->until) stepZone(zc);
+	if (!zc->rules) {
+		*dst = zc->dst;
+		return zc->quarters * 900L;
+	}
+
+	long offset = tzOffset(tznum);
+	*dst = isDstAt(tznum, utc + offset);
+	return *dst ? offset + 3600 : offset;
+}
+
+// point zc at the first record of the provided timezone, which holds from the epoch
+void seekZone(int tznum, zoneCursor* zc) {
+	zc->zone = tznum;
+	zc->next = LOADINT(TZ_TRANS_AT + tznum);
+	zc->from = 0;
+	zc->until = 0;
+	// no records: the rules have applied all along
+	zc->rules = (zc->next == (unsigned int)LOADINT(TZ_TRANS_AT + tznum + 1));
+	// the first record's gap is always 0, from the epoch
+	if (!zc->rules) zc->next++;
+}
+
+// take the state of the record zc points at, then read the gap to the next one: a
+// record is the gap in minutes seven bits a byte, least significant first, the top bit
+// set on all but the last, then the offset in quarter hours (low seven bits, two's
+// complement) with 0x80 for DST. The zone's last record marks where its rules take over
+void stepZone(zoneCursor* zc) {
+	byte state = LOADBYTE(TZ_TRANS + zc->next++);
+	zc->from = zc->until;
+	zc->quarters = (signed char)(state << 1) >> 1;
+	zc->dst = state & 0x80;
+	if (zc->next == (unsigned int)LOADINT(TZ_TRANS_AT + zc->zone + 1)) {
+		zc->rules = true;
+		return;
+	}
+
+	unsigned long gap = 0;
+	byte b, shift = 0;
+	do {
+		b = LOADBYTE(TZ_TRANS + zc->next++);
+		gap |= (unsigned long)(b & 0x7F) << shift;
+		shift += 7;
+	} while (b & 0x80);
+	zc->until = zc->from + gap * 60;
+}
+
+// determine if the provided local standard time falls within daylight savings time
+bool isDstAt(int tznum, epoch_t local) {
 	int ds = LOADBYTE(TZ_DST + tznum);
 	// return immediately if not a DST time zone
 	if (ds == DS_NONE) return false;
 
-	int m = ltime[MONTH], sm = DS_SMON[ds], fm = DS_FMON[ds], sd, fd;
+	// northern rulesets start and finish within the year, southern ones wrap around it
+	if (dsStart[ds] < dsFinish[ds]) return (local >= dsStart[ds] && local < dsFinish[ds]);
+	return (local >= dsStart[ds] || local < dsFinish[ds]);
+}
+
+// recalculate the DST transitions (local standard time) of every ruleset when utc leaves the cached year
+void updateDst() {
+	if (utc >= dsYearStart && utc < dsYearEnd) return;
+
+	int ut[SZ_TIME];
+	decodeTime(utc, ut);
+	int year = ut[YEAR];
+	for (int ds = DS_NONE + 1; ds < SZ_DS; ds++) {
+		if (year >= DS_FIRST_YEAR && year <= DS_LAST_YEAR) {
+			// precomputed at compile time by dstables.h
+			const dsYearDays* days = DS_DAYS + ds * DS_YEARS + year - DS_FIRST_YEAR;
+			dsStart[ds] = (epoch_t)(unsigned int)LOADINT(&days->start) * SECS_DAY;
+			dsFinish[ds] = (epoch_t)(unsigned int)LOADINT(&days->finish) * SECS_DAY;
+		}
+		else {
+			dsStart[ds] = dsTransition(year, LOADBYTE(DS_SMON + ds), LOADBYTE(DS_SWEEK + ds), LOADBYTE(DS_SDOW + ds),
+				LOADBYTE(DS_SDAY + ds));
+			dsFinish[ds] = dsTransition(year, LOADBYTE(DS_FMON + ds), LOADBYTE(DS_FWEEK + ds), LOADBYTE(DS_FDOW + ds),
+				LOADBYTE(DS_FDAY + ds));
+		}
+		dsStart[ds] += LOADINT(DS_STIME + ds) * 60L;
+		dsFinish[ds] += LOADINT(DS_FTIME + ds) * 60L;
+	}
+
+	ut[MONTH] = 1;
+	ut[DAY] = 1;
+	ut[HOUR] = ut[MINUTE] = ut[SECOND] = 0;
+	dsYearStart = encodeTime(ut);
+	ut[YEAR]++;
+	dsYearEnd = encodeTime(ut);
+}
+
+// start of the day (local standard time) a DST rule falls on in the provided year;
+// week 0 is the last matching day of the week in the previous month
+epoch_t dsTransition(int year, int month, int week, int dow, int day) {
+	int t[SZ_TIME] = { year, month, 1, 0, 0, 0, 0 };
+	epoch_t first = encodeTime(t);
 
 	// if day of month provided, just use that...
-	if (DS_SDAY[ds]) sd = DS_SDAY[ds];
-	// otherwise, calculate start and end calendar days assuming we're in the right month
-	else {
-		int sdow = DS_SDOW[ds], syear = ltime[YEAR];
-		sd = ((ltime[DAY] - ltime[DOW] + sdow) % 7) + (7 * (DS_SWEEK[ds] - 1));
-		if (sd < 1) normalizeDate(&sdow, &sd, &sm, &syear);
+	if (day) return first + (day - 1) * SECS_DAY;
+	// otherwise, find the first matching day of the week and count weeks from there
+	int firstDow = (first / SECS_DAY + EPOCH_DOW) % 7;
+	long offset = ((dow - firstDow + 7) % 7) + 7 * (week - 1);
+	return first + offset * SECS_DAY;
+}
+
+// convert utc once into each zone the view shows, and local time, which the day
+// symbols compare against
+void takeSnapshot() {
+	if (viewZones & (1 << ZONE_UTC)) snapZone(TZ_UTC, &snapUtc, &utcCursor);
+	for (int t = 0; t < SZ_TZ; t++) {
+		if (t == TZ_LOCAL || (viewZones & (1 << t))) snapZone(tz[t], &snap[t], &snapCursor[t]);
 	}
+}
 
-	// ditto for finish day
-	if (DS_FDAY[ds]) fd = DS_FDAY[ds];
-	else {
-		int fdow = DS_FDOW[fd], fyear = ltime[YEAR];
-		fd = ((ltime[DAY] - ltime[DOW] + DS_FDOW[ds]) % 7) + (7 * (DS_FWEEK[ds] - 1));
-		if (fd < 1) normalizeDate(&fdow, &fd, &fm, &fyear);
-	}
-
-	// re-order month values (if necessary) then compare
-	if (sm > fm) {
-		fm += 12;
-		m += 12;
-	}
-	if (m < sm || m > fm) return false;
-	if (m == sm && ltime[DAY] < sd) return false; 
-	if (m == fm && ltime[DAY] > sd) return false; 
-
-	// at this point, it's not *not* DST, so return true
-	return true;
-}
-
-// determine if it is currently the next day in specified timezone
-bool isNextDay(int tznum) {
-	// add 24 hours/60 minute offsets to work around some apparent unsigned/signed casting issue
-	int thatTzHour = LOADINT(TZ_HOUR + tznum) + 24, thatTzMin = LOADINT(TZ_MIN + tznum)+ 60;
-	int thisTzHour = LOADINT(TZ_HOUR + tz[TZ_LOCAL]) + 24, thisTzMin = LOADINT(TZ_MIN + tz[TZ_LOCAL]) + 60;
-	// only possible for timezones larger than local
-	if (thatTzHour > thisTzHour) return false;
-	if (thatTzMin > thisTzMin) return false;
-
-	utcToLocal(tznum);
-	int thatDay = ltime[DAY];
-	utcToLocal(tz[TZ_LOCAL]);
-	int thisDay = ltime[DAY];
-	if (thisDay != thatDay) return true;
-	return false;
-}
-
-// determine if it is currently the previous day in specified timezone
-bool isPrevDay(int tznum) {
-	// add 24 hours/60 minute offsets to work around some apparent unsigned/signed casting issue
-	int thatTzHour = LOADINT(TZ_HOUR + tznum) + 24, thatTzMin = LOADINT(TZ_MIN + tznum)+ 60;
-	int thisTzHour = LOADINT(TZ_HOUR + tz[TZ_LOCAL]) + 24, thisTzMin = LOADINT(TZ_MIN + tz[TZ_LOCAL]) + 60;
-	// only possible for timezones smaller than local
-	if (thatTzHour < thisTzHour) return false;
-	if (thatTzMin < thisTzMin) return false;
-
-	utcToLocal(tznum);
-	int thatday = ltime[DAY];
-	utcToLocal(tz[TZ_LOCAL]);
-	int thisday = ltime[DAY];
-	if (thisday != thatday) return true;
-	return false;
+// snapshot of a field's bound zone
+const zoneSnap* boundSnap(byte zone) {
+	return zone == ZONE_UTC ? &snapUtc : &snap[zone];
+}
+
+// populate a snapshot entry by adjusting utc into the provided timezone
+void snapZone(int tznum, zoneSnap* zs, zoneCursor* zc) {
+	int lt[SZ_TIME];
+	epoch_t local = utc + zoneOffset(tznum, zc, &zs->dst);
+
+	decodeTime(local, lt);
+
+	zs->year = lt[YEAR];
+	zs->month = lt[MONTH];
+	zs->day = lt[DAY];
+	zs->dow = lt[DOW];
+	zs->hour = lt[HOUR];
+	zs->minute = lt[MINUTE];
+	zs->days = local / SECS_DAY;
+}
+
+// symbol for a snapshot that is on the next or previous day relative to local time
+char daySymbol(const zoneSnap* zs) {
+	if (zs->days > snap[TZ_LOCAL].days) return SYM_NEXTDAY;
+	if (zs->days < snap[TZ_LOCAL].days) return SYM_PREVDAY;
+	return ' ';
+}
+
+// symbol for a snapshot that is currently in daylight savings time
+char dstSymbol(const zoneSnap* zs) {
+	#ifdef SHOWDST
+	if (zs->dst) return SYM_DST;
+	#endif
+	return ' ';
 }
 
 // DISPLAY FUNCTIONS
 
 // render the date and clocks (local, zulu, tz1-tz3) to the displays
 void updateDisp(bool refresh) {
-	// build formatted times
-	char date[8], dow[8], utcTime[8], dispTime[SZ_TZ][8];
-   char dst [SZ_TZ], day[SZ_TZ], dayUtc;  // symbols for DST, previous/next day
+	#ifdef PROFILE
+	fRendering = true;
+	#endif
 
-	// set indicator characters first
-	for (int t = 0; t < SZ_TZ; t++) {
-		// day: next, prev, or blank
-		if (isNextDay(tz[t])) day[t] = SYM_NEXTDAY;
-		else if (isPrevDay(tz[t])) day[t] = SYM_PREVDAY;
-		else day[t] = ' ';
-		#ifdef SHOWDST
-		if(isDst(tz[t])) dst[t] = SYM_DST;
-		else dst[t] = ' ';
-		#else
-		dst[t] = ' ';
-		#endif
-	}
-	if (isNextDay(TZ_UTC)) dayUtc = SYM_NEXTDAY;
-	else if (isPrevDay(TZ_UTC)) dayUtc = SYM_PREVDAY;
-	else dayUtc = ' ';
-
-	// populate UTC
-   sprintf(utcTime, "%c%02d:%02dZ", dayUtc, time[HOUR], time[MINUTE]);
-	// make adjustments for localized times
-	utcToLocal(tz[TZ_LOCAL]);
-	sprintf(date, "%02d%s%02d", ltime[DAY], MON_NAME[ltime[MONTH]], ltime[YEAR]);
-	sprintf(dow, "  %s  ", DOW_NAME[ltime[DOW]]);
-	// populate time strings for every time zone other than UTC
-	for (int t = 0; t < SZ_TZ; t++) {
-		utcToLocal(tz[t]);
-		sprintf(dispTime[t], "%c%02d:%02d%c", day[t], ltime[HOUR], ltime[MINUTE], dst[t]);
-	}
+	// convert every zone once, then derive all fields and indicators from that
+	PROBE_START(PROBE_SNAPSHOT);
+	takeSnapshot();
+	PROBE_STOP(PROBE_SNAPSHOT);
+	PROBE_START(PROBE_COMPOSE);
+	composeFrame();
+	PROBE_STOP(PROBE_COMPOSE);
 
+	// send only what differs from the panels
+	PROBE_START(PROBE_FLUSH);
 	if (refresh) {
 		clearScreen(LCD0);
 		clearScreen(LCD1);
 	}
-	
-	// print date, time, and UTC
-	if (primaryView) {
-		printAt(LCD0, 0, 0, date);
-		printAt(LCD0, 1, 0, dow);
-		printAt(LCD0, 0, 9, dispTime[0]);
-		printAt(LCD0, 1, 9, utcTime);
-		// draw heartbeat
-		if (time[SECOND] % 2) {
-			printAt(LCD0, 0, 12, " ");
+	flushPanels();
+	PROBE_STOP(PROBE_FLUSH);
+
+	#ifdef PROFILE
+	fRendering = false;
+	#endif
+}
+
+// make a view current, and note which zones its fields bind so only those are converted
+void selectView(byte v) {
+	view = v;
+	viewZones = viewGlyphs = 0;
+	for (int f = LOADBYTE(LAYOUT_VIEW + v); f < LOADBYTE(LAYOUT_VIEW + v + 1); f++) {
+		byte zone = LOADBYTE(&LAYOUT_FIELD[f].zone);
+		if (zone != ZONE_NONE) viewZones |= 1 << zone;
+		if (LOADBYTE(&LAYOUT_FIELD[f].type) == FLD_BIG) viewGlyphs |= 1 << LOADBYTE(&LAYOUT_FIELD[f].panel);
+	}
+}
+
+// walk the active view's fields, formatting each from the snapshot straight into
+// lcdFrame, clipped to the field's width
+void composeFrame() {
+	// compose the whole frame from a blank one
+	memset(lcdFrame, ' ', sizeof(lcdFrame));
+
+	for (int f = LOADBYTE(LAYOUT_VIEW + view); f < LOADBYTE(LAYOUT_VIEW + view + 1); f++) {
+		const layoutField* field = &LAYOUT_FIELD[f];
+		byte type = LOADBYTE(&field->type);
+		byte zone = LOADBYTE(&field->zone);
+		byte panel = LOADBYTE(&field->panel), row = LOADBYTE(&field->row), col = LOADBYTE(&field->col);
+		byte last = col + LOADBYTE(&field->width);
+		const zoneSnap* zs = zone == ZONE_NONE ? NULL : boundSnap(zone);
+		if (row >= SZ_ROW || col >= SZ_COL) continue;
+		char* out = &lcdFrame[panel][row][col];
+		const char* end = &lcdFrame[panel][row][last < SZ_COL ? last : SZ_COL];
+
+		switch (type) {
+		case FLD_TIME:
+			fmtTime(out, end, zs, dstSymbol(zs));
+			break;
+		case FLD_UTC:
+			fmtTime(out, end, zs, 'Z');
+			break;
+		case FLD_LABEL:
+			if (zone == ZONE_UTC) fmtName(out, end, PSTR("UTC"));
+			else for (const char* c = tzLabel[zone]; *c; c++) out = fmtChar(out, end, *c);
+			break;
+		case FLD_DATE:
+			out = fmt2(out, end, zs->day);
+			out = fmtName(out, end, MON_NAME[zs->month]);
+			fmt2(out, end, zs->year);
+			break;
+		case FLD_DOW:
+			fmtName(out, end, DOW_NAME[zs->dow]);
+			break;
+		case FLD_BIG:
+			printBig(panel, col, zs);
+			break;
+		case FLD_HEART:
+			// blink the field underneath by blanking it every other second
+			if (utc % 2) memset(out, ' ', end - out);
+			break;
+		}
+	}
+}
+
+// FIELD FORMATTERS: each writes at out, stops short of end, and returns where it got to
+
+char* fmtChar(char* out, const char* end, char c) {
+	if (out < end) *out++ = c;
+	return out;
+}
+
+// two decimal digits, 00 to 99
+char* fmt2(char* out, const char* end, byte v) {
+	const char* pair = DIGIT_PAIR + 2 * (v % 100);
+	out = fmtChar(out, end, LOADBYTE(pair));
+	return fmtChar(out, end, LOADBYTE(pair + 1));
+}
+
+// a name from flash, such as DOW_NAME or MON_NAME
+char* fmtName(char* out, const char* end, const char* name) {
+	for (char c = LOADBYTE(name); c; c = LOADBYTE(++name)) out = fmtChar(out, end, c);
+	return out;
+}
+
+// day symbol, hh:mm and a suffix (the DST symbol, or Z)
+char* fmtTime(char* out, const char* end, const zoneSnap* zs, char suffix) {
+	out = fmtChar(out, end, daySymbol(zs));
+	out = fmt2(out, end, zs->hour);
+	out = fmtChar(out, end, ':');
+	out = fmt2(out, end, zs->minute);
+	return fmtChar(out, end, suffix);
+}
+
+#ifdef PROFILE
+// a number right-aligned in width columns (wider if it needs to be)
+char* fmtNum(char* out, const char* end, unsigned long v, int width) {
+	char digits[10];
+	int n = 0;
+	do {
+		digits[n++] = '0' + v % 10;
+		v /= 10;
+	} while (v);
+	for (; width > n; width--) out = fmtChar(out, end, ' ');
+	while (n) out = fmtChar(out, end, digits[--n]);
+	return out;
+}
+
+// PROFILING FUNCTIONS
+
+// add one timed run of a phase to its counters and histogram
+void probeRecord(byte probe, unsigned long cycles) {
+	probeStat* ps = &probes[probe];
+	int bucket = 0;
+	for (unsigned long limit = PROBE_BASE; cycles >= limit && bucket < SZ_HIST - 1; limit <<= 1) bucket++;
+
+	if (!ps->count || cycles < ps->min) ps->min = cycles;
+	if (cycles > ps->max) ps->max = cycles;
+	ps->count++;
+	// halve the mean's sum and runs together rather than let the sum overflow
+	if (ps->total > 0xFFFFFFFFUL - cycles) {
+		ps->total >>= 1;
+		ps->runs >>= 1;
+	}
+	ps->total += cycles;
+	ps->runs++;
+	ps->hist[bucket]++;
+}
+
+void probeReset() {
+	memset(probes, 0, sizeof(probes));
+	probeOverruns = 0;
+}
+
+// one line per phase: runs, min, max and mean cycles, then the histogram buckets;
+// then the overruns, duty cycle, queue high-water marks and stalls, RTC read time
+// and boot phases
+void probeDump() {
+	char line[16 + 10 * (4 + SZ_HIST)];
+	const char* end = line + sizeof(line) - 3;
+
+	strcpy(fmtName(line, end, PSTR("phase        count      min      max     mean   histogram (<128, <256, ...)")), "\r\n");
+	halDebugWrite(line);
+	for (int p = 0; p < SZ_PROBE; p++) {
+		const probeStat* ps = &probes[p];
+		char* out = fmtName(line, end, PROBE_NAME[p]);
+		while (out < line + 8) out = fmtChar(out, end, ' ');
+		out = fmtNum(out, end, ps->count, 9);
+		out = fmtNum(out, end, ps->min, 9);
+		out = fmtNum(out, end, ps->max, 9);
+		out = fmtNum(out, end, ps->runs ? ps->total / ps->runs : 0, 9);
+		out = fmtChar(out, end, ' ');
+		for (int b = 0; b < SZ_HIST; b++) {
+			out = fmtChar(out, end, ' ');
+			out = fmtNum(out, end, ps->hist[b], 7);
 		}
-		// print additional time zones
-		printAt(LCD1, 0, 0, dispTime[1]);
-		printAt(LCD1, 1, 1, tzLabel[1]);
-		printAt(LCD1, 0, 8, dispTime[2]);
-		printAt(LCD1, 1, 9, tzLabel[2]);
-	} else {
-		printAt(LCD0, 0, 0, dispTime[3]);
-		printAt(LCD0, 1, 1, tzLabel[3]);
-		printAt(LCD0, 0, 8, dispTime[4]);
-		printAt(LCD0, 1, 9, tzLabel[4]);
-		printAt(LCD1, 0, 0, dispTime[5]);
-		printAt(LCD1, 1, 1, tzLabel[5]);
-		printAt(LCD1, 0, 8, dispTime[6]);
-		printAt(LCD1, 1, 9, tzLabel[6]);
+		strcpy(out, "\r\n");
+		halDebugWrite(line);
+	}
+
+	probeFigure(PSTR("overruns"), probeOverruns);
+	probeFigure(PSTR("duty pm"), dutyCycle);
+	probeFigure(PSTR("txhigh 0"), txHigh[LCD0]);
+	probeFigure(PSTR("txhigh 1"), txHigh[LCD1]);
+	probeFigure(PSTR("stalls"), txStalls);
+	probeFigure(PSTR("rtc us"), rtcBusMicros);
+	for (int b = 0; b < SZ_BOOT; b++) probeFigure(BOOT_NAME[b], bootTime[b]);
+}
+
+// one named figure from flash on a line of its own, lined up with the phases
+void probeFigure(const char* name, unsigned long v) {
+	char line[8 + 10 + 3];
+	const char* end = line + sizeof(line) - 3;
+	char* out = fmtName(line, end, name);
+	while (out < line + 8) out = fmtChar(out, end, ' ');
+	out = fmtNum(out, end, v, 9);
+	strcpy(out, "\r\n");
+	halDebugWrite(line);
+}
+
+// debug serial commands: p dumps the probes, r resets them
+void probePoll() {
+	for (int c = halDebugRead(); c >= 0; c = halDebugRead()) {
+		if (c == 'p') probeDump();
+		if (c == 'r') probeReset();
 	}
 }
+#endif
 
 // LCD HELPERS
 
-// printAt prints the provided string onto the provided display at the specified
-// row and column (zero-indexed)
-void printAt(SoftwareSerial &disp, int row, int column, const char* str) {
-	moveCursor(disp, row, column);
-	disp.print(str);
+// printBig places hh:mm in big digits across both rows from the provided column:
+// three columns a digit, a gap between the digits of a pair, and a colon between pairs
+void printBig(int disp, int column, const zoneSnap* zs) {
+	const byte digit[4] = { (byte)(zs->hour / 10), (byte)(zs->hour % 10), (byte)(zs->minute / 10), (byte)(zs->minute % 10) };
+	const int at[4] = { 0, 4, 8, 12 };
+
+	for (int row = 0; row < SZ_ROW; row++) {
+		char* cells = lcdFrame[disp][row];
+		for (int d = 0; d < 4; d++) {
+			for (int c = 0; c < BIG_WIDTH; c++) {
+				int col = column + at[d] + c;
+				if (col < SZ_COL) cells[col] = LOADBYTE(&BIG_DIGIT[digit[d]][row][c]);
+			}
+		}
+		if (column + 7 < SZ_COL) cells[column + 7] = BIG_COLON;
+	}
+}
+
+// loadGlyphs writes the big-digit segments into the CGRAM of each panel the view
+// needs them on, once: they stay there until the panel loses power. The upload is
+// larger than the queue, so each glyph goes with its own address and only when it
+// fits; the rest follow in later passes. Returns the panels still loading, which
+// includes those whose queue hasn't yet drained of the upload.
+byte loadGlyphs() {
+	byte loading = 0;
+	for (int disp = 0; disp < SZ_LCD; disp++) {
+		if (!(viewGlyphs & ~lcdGlyphs & (1 << disp))) continue;
+		while (glyphNext[disp] < SZ_GLYPH && lcdDepth(disp) + 2 + 8 < SZ_TXQ) {
+			byte g = glyphNext[disp]++;
+			lcdWrite(disp, 0xFE);
+			lcdWrite(disp, 0x40 + g * 8);
+			for (int r = 0; r < 8; r++) lcdWrite(disp, LOADBYTE(&BIG_GLYPH[g][r]));
+		}
+		// flushDisp() moves the cursor back to the display RAM before its first write
+		if (glyphNext[disp] == SZ_GLYPH && !lcdDepth(disp)) lcdGlyphs |= 1 << disp;
+		else loading |= 1 << disp;
+	}
+	return loading;
+}
+
+// flushPanels queues the glyphs the view still needs, then the frame to each panel
+// that isn't waiting on them, so a view change never fills a queue
+void flushPanels() {
+	byte loading = loadGlyphs();
+	for (int disp = 0; disp < SZ_LCD; disp++) {
+		if (!(loading & (1 << disp))) flushDisp(disp);
+	}
+}
+
+// flushDisp sends every cell where the frame differs from the shadow, merging
+// changes separated by a short gap into one run so each run costs one cursor move
+void flushDisp(int disp) {
+	for (int row = 0; row < SZ_ROW; row++) {
+		char* shadow = lcdShadow[disp][row];
+		const char* frame = lcdFrame[disp][row];
+
+		int col = 0;
+		while (col < SZ_COL) {
+			if (shadow[col] == frame[col]) {
+				col++;
+				continue;
+			}
+			// extend the run until more than LCD_MERGE unchanged cells follow it
+			int last = col;
+			for (int c = col + 1; c < SZ_COL && c - last <= LCD_MERGE + 1; c++) {
+				if (shadow[c] != frame[c]) last = c;
+			}
+
+			moveCursor(disp, row, col);
+			for (; col <= last; col++) {
+				lcdWrite(disp, frame[col]);
+				shadow[col] = frame[col];
+			}
+		}
+	}
 }
 
 // moveCursor moves to the specified row and column (zero-indexed)
-void moveCursor(SoftwareSerial &disp, int row, int col) {
+void moveCursor(int disp, int row, int col) {
 	// error checking
 	if (row < 0 || row > 1 || col < 0 || col > 15) return;
 
 	// set cursor
-	disp.write(0xFE);
-	disp.write((row * 0x40) + col + 0x80);
-	delay(1);
+	lcdWrite(disp, 0xFE);
+	lcdWrite(disp, (row * 0x40) + col + 0x80);
 }
 
-// clearScreen erases all characters from the display
-void clearScreen(SoftwareSerial &disp) {
-	disp.write(0xFE);
-	disp.write(0x01);
-	delay(1);
+// clearScreen erases all characters from the display (and its shadow)
+void clearScreen(int disp) {
+	lcdWrite(disp, 0xFE);
+	lcdWrite(disp, 0x01);
+	memset(lcdShadow[disp], ' ', sizeof(lcdShadow[disp]));
 }
 
 // setSplash configures the splash screen
-void setSplash(SoftwareSerial &disp) {
-	disp.print(F("   WorldClock   "));
-	disp.print(F("  (multi-zone)  "));
-	disp.write(0x7C);
-	disp.write(0x0A);
+void setSplash(int disp) {
+	lcdPrint_P(disp, PSTR("   WorldClock   "));
+	lcdPrint_P(disp, PSTR("  (multi-zone)  "));
+	lcdWrite(disp, 0x7C);
+	lcdWrite(disp, 0x0A);
 }
 
 // setBacklight turns on or off the backlight
-void setBacklight(SoftwareSerial &disp, bool state) {
+void setBacklight(int disp, bool state) {
 	int blPower = 0x80;
 
 	if (state) blPower = 0x9D;
 
-	disp.write(0x7C);
-	disp.write(blPower);
+	lcdWrite(disp, 0x7C);
+	lcdWrite(disp, blPower);
+}
+
+// LCD TRANSMIT QUEUE
+
+// lcdWrite queues one byte for the provided display. It only waits if the queue
+// is full, which SZ_TXQ is sized to prevent for a full redraw.
+void lcdWrite(int disp, byte b) {
+	byte next = (txHead[disp] + 1) % SZ_TXQ;
+	if (next == txTail[disp]) {
+		txStalls++;
+		while (next == txTail[disp]) halTxWait(disp);
+	}
+	txQueue[disp][txHead[disp]] = b;
+	txHead[disp] = next;
+	halTxStart();
+
+	byte depth = lcdDepth(disp);
+	if (depth > txHigh[disp]) txHigh[disp] = depth;
+}
+
+// lcdPrint_P queues a string stored in flash
+void lcdPrint_P(int disp, const char* str) {
+	for (byte c = LOADBYTE(str); c; c = LOADBYTE(++str)) lcdWrite(disp, c);
+}
+
+// lcdDepth returns the number of bytes waiting to be sent to the provided display
+byte lcdDepth(int disp) {
+	return (txHead[disp] - txTail[disp] + SZ_TXQ) % SZ_TXQ;
+}
+
+// lcdNext removes and returns the next byte queued for the provided display, or
+// -1 if there is none. Called by the HAL transmitter, normally from its interrupt.
+int lcdNext(int disp) {
+	if (txHead[disp] == txTail[disp]) return -1;
+	byte b = txQueue[disp][txTail[disp]];
+	txTail[disp] = (txTail[disp] + 1) % SZ_TXQ;
+	return b;
 }
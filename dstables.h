@@ -0,0 +1,96 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This header expands every DS_* ruleset in timezones.h into the concrete days its
+ * transitions fall on, for each year from DS_FIRST_YEAR to DS_LAST_YEAR, at
+ * compile time. The result is the PROGMEM table DS_DAYS, so updateDst() only has
+ * to look up a year; dsTransition() still covers years outside the span.
+ *
+ * The static_asserts at the bottom check the expansion against known dates, so a
+ * bad rule or a broken expansion fails the build.
+ */
+
+// span of years (since EPOCH_YEAR) expanded into DS_DAYS
+#define DS_FIRST_YEAR	15
+#define DS_LAST_YEAR		45
+#define DS_YEARS			(DS_LAST_YEAR - DS_FIRST_YEAR + 1)
+
+// transition days of one ruleset in one year, as days since the epoch
+struct dsYearDays {
+	unsigned int start, finish;
+};
+
+// compile-time calendar, mirroring daysFromCivil() and dsTransition()
+constexpr long ceCivil(long y, int month, int day) {
+	return DAYS_MAR + 365 * y + y / 4 - y / 100 + (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+}
+
+constexpr long ceDate(int year, int month, int day) {
+	return year == EPOCH_YEAR && month <= 2 ? (month - 1) * 31 + day - 1
+		: ceCivil(year - EPOCH_YEAR - (month <= 2), month, day);
+}
+
+constexpr long ceMonthStart(int year, int month) {
+	return ceDate(year, month, 1);
+}
+
+// day a rule falls on; week 0 is the last matching day of the week in the previous month
+constexpr long ceRuleDay(int year, int month, int week, int dow, int day) {
+	return day ? ceDate(year, month, day)
+		: ceMonthStart(year, month) + (dow - (ceMonthStart(year, month) + EPOCH_DOW) % 7 + 7) % 7 + 7 * (week - 1);
+}
+
+constexpr dsYearDays ceRuleset(int ds, int year) {
+	return ds == DS_NONE ? dsYearDays{ 0, 0 } : dsYearDays{
+		(unsigned int)ceRuleDay(year, DS_SMON[ds], DS_SWEEK[ds], DS_SDOW[ds], DS_SDAY[ds]),
+		(unsigned int)ceRuleDay(year, DS_FMON[ds], DS_FWEEK[ds], DS_FDOW[ds], DS_FDAY[ds]) };
+}
+
+// entry i of DS_DAYS: ruleset i / DS_YEARS, year DS_FIRST_YEAR + i % DS_YEARS
+constexpr dsYearDays ceEntry(int i) {
+	return ceRuleset(i / DS_YEARS, DS_FIRST_YEAR + i % DS_YEARS);
+}
+
+// index sequence 0..N-1, built by halving to keep template recursion shallow
+template<int... I> struct dsSeq {};
+template<class A, class B> struct dsConcat;
+template<int... A, int... B> struct dsConcat<dsSeq<A...>, dsSeq<B...> > {
+	typedef dsSeq<A..., (int)sizeof...(A) + B...> type;
+};
+template<int N> struct dsMakeSeq {
+	typedef typename dsConcat<typename dsMakeSeq<N / 2>::type, typename dsMakeSeq<N - N / 2>::type>::type type;
+};
+template<> struct dsMakeSeq<0> { typedef dsSeq<> type; };
+template<> struct dsMakeSeq<1> { typedef dsSeq<0> type; };
+
+// one PROGMEM table with an entry per index in the sequence
+template<class S> struct dsExpand;
+template<int... I> struct dsExpand<dsSeq<I...> > {
+	static const dsYearDays days[sizeof...(I)];
+};
+template<int... I> const dsYearDays dsExpand<dsSeq<I...> >::days[sizeof...(I)] PROGMEM = { ceEntry(I)... };
+
+#define DS_DAYS (dsExpand<dsMakeSeq<SZ_DS * DS_YEARS>::type>::days)
+
+// known transitions, from published calendars
+static_assert(ceDate(15, 3, 1) == 5538, "epoch day count is wrong");
+static_assert(ceDate(1, 1, 1) == 366 && ceDate(0, 2, 29) == 59, "2000 must be a leap year");
+static_assert(ceDate(100, 3, 1) - ceDate(100, 2, 28) == 1, "2100 must not be a leap year");
+static_assert((ceDate(15, 3, 8) + EPOCH_DOW) % 7 == 0, "day of week is wrong");
+static_assert(ceEntry(DS_NAMERICA * DS_YEARS + 15 - DS_FIRST_YEAR).start == ceDate(15, 3, 8), "NAMERICA start 2015");
+static_assert(ceEntry(DS_NAMERICA * DS_YEARS + 15 - DS_FIRST_YEAR).finish == ceDate(15, 11, 1), "NAMERICA finish 2015");
+static_assert(ceEntry(DS_NAMERICA * DS_YEARS + 24 - DS_FIRST_YEAR).start == ceDate(24, 3, 10), "NAMERICA start 2024");
+static_assert(ceEntry(DS_NAMERICA * DS_YEARS + 24 - DS_FIRST_YEAR).finish == ceDate(24, 11, 3), "NAMERICA finish 2024");
+static_assert(ceEntry(DS_EUROPE_CET * DS_YEARS + 15 - DS_FIRST_YEAR).start == ceDate(15, 3, 29), "EUROPE start 2015");
+static_assert(ceEntry(DS_EUROPE_CET * DS_YEARS + 15 - DS_FIRST_YEAR).finish == ceDate(15, 10, 25), "EUROPE finish 2015");
+static_assert(ceEntry(DS_EUROPE_CET * DS_YEARS + 45 - DS_FIRST_YEAR).start == ceDate(45, 3, 26), "EUROPE start 2045");
+static_assert(ceEntry(DS_EUROPE_CET * DS_YEARS + 45 - DS_FIRST_YEAR).finish == ceDate(45, 10, 29), "EUROPE finish 2045");
+static_assert(ceEntry(DS_AUSTRALIA * DS_YEARS + 15 - DS_FIRST_YEAR).start == ceDate(15, 10, 4), "AUSTRALIA start 2015");
+static_assert(ceEntry(DS_AUSTRALIA * DS_YEARS + 15 - DS_FIRST_YEAR).finish == ceDate(15, 4, 5), "AUSTRALIA finish 2015");
+static_assert(ceEntry(DS_NZEALAND * DS_YEARS + 20 - DS_FIRST_YEAR).start == ceDate(20, 9, 27), "NZEALAND start 2020");
+static_assert(ceEntry(DS_NZEALAND * DS_YEARS + 20 - DS_FIRST_YEAR).finish == ceDate(20, 4, 5), "NZEALAND finish 2020");
+static_assert(ceEntry(DS_ISRAEL * DS_YEARS + 15 - DS_FIRST_YEAR).start == ceDate(15, 3, 26), "ISRAEL start 2015");
+static_assert(ceEntry(DS_CHILE * DS_YEARS + 23 - DS_FIRST_YEAR).start == ceDate(23, 9, 2), "CHILE start 2023");
+static_assert(ceEntry(DS_NONE * DS_YEARS).start == 0, "DS_NONE must expand to nothing");
@@ -0,0 +1,362 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file implements the hardware abstraction layer for AVR Arduinos: buttons
+ * (with pin-change interrupts), EEPROM, the DS1302 RTC, the one-second tick, and
+ * the Timer2 software transmitter for the LCDs.
+ */
+
+#ifdef __AVR__
+
+#include <Arduino.h>
+#include <avr/eeprom.h>
+#include <avr/power.h>
+#include <avr/sleep.h>
+#include "HAL.h"
+#include "IO.h"
+
+// number of LCDs driven by the transmitter
+#define SZ_PORT		2
+
+// DS1302 commands (the read form sets bit 0) and register bits
+#define RTC_BURST		0xBE		// all seven clock registers plus control, in one transaction
+#define RTC_CONTROL	0x8E
+#define RTC_WP			0x80		// control: write protect
+#define RTC_CH			0x80		// seconds: clock halt
+#define SZ_RTC			7			// clock registers read per burst
+
+// Timer1 runs in CTC mode at clk/256; each tick's length in counts is kept in 16.16
+// fixed point so the trim can be much finer than one count (16us at 16MHz)
+#define TICK_COUNTS	(F_CPU / 256)
+#define TICK_US(c)	((c) * 256UL / (F_CPU / 1000000))
+
+// reset cause, caught in .init3 (after the zero register is set up, before
+// anything can touch r2). Optiboot clears MCUSR but passes it on in r2, so take both.
+static byte resetFlags __attribute__((section(".noinit")));
+void saveResetFlags() __attribute__((naked, used, section(".init3")));
+void saveResetFlags() {
+	__asm__ __volatile__ ("sts %0, r2" : "=m" (resetFlags));
+	resetFlags |= MCUSR;
+	MCUSR = 0;
+}
+
+static void (*tickHandler)() = NULL;
+static volatile uint32_t tickPeriod = (uint32_t)TICK_COUNTS << 16;
+static uint16_t tickFrac = 0;					// fraction of a count carried to the next tick
+
+// RTC bus pins, resolved to registers once so a transaction doesn't go through digitalWrite()
+static volatile uint8_t *rtcOut, *rtcIn, *rtcMode;
+static byte rtcCe, rtcIo, rtcSclk;
+
+// transmitter state, only touched by the Timer2 interrupt once running
+static volatile uint8_t* txPort[SZ_PORT];	// output register and bit of each panel's pin
+static byte txMask[SZ_PORT];
+static uint16_t txShift[SZ_PORT];			// bits of the frame being sent, LSB first
+static byte txBits[SZ_PORT];					// bits left in that frame
+static byte txIdle[SZ_PORT];					// idle bit times to hold after that frame
+static bool txCmd[SZ_PORT];					// previous byte was a command prefix
+
+// configure buttons, then drive the panel pins idle-high and start Timer2 at one
+// tick per bit
+void halBegin() {
+	const byte pins[SZ_PORT] = { LCD0_OUT, LCD1_OUT };
+
+	for (int b = 0; b < SZ_BUTTON; b++) pinMode(BUTTON[b], INPUT);
+
+	// the RTC pins share a port: CE and SCLK idle low, IO only driven while writing
+	pinMode(RTC_CE, OUTPUT);
+	pinMode(RTC_SCLK, OUTPUT);
+	pinMode(RTC_IO, INPUT);
+	rtcOut = portOutputRegister(digitalPinToPort(RTC_CE));
+	rtcIn = portInputRegister(digitalPinToPort(RTC_CE));
+	rtcMode = portModeRegister(digitalPinToPort(RTC_CE));
+	rtcCe = digitalPinToBitMask(RTC_CE);
+	rtcIo = digitalPinToBitMask(RTC_IO);
+	rtcSclk = digitalPinToBitMask(RTC_SCLK);
+	*rtcOut &= ~(rtcCe | rtcSclk | rtcIo);
+
+	// nothing uses the ADC, SPI, TWI or USART, so stop their clocks
+	ADCSRA &= ~_BV(ADEN);
+	power_adc_disable();
+	power_spi_disable();
+	power_twi_disable();
+	power_usart0_disable();
+
+	for (int d = 0; d < SZ_PORT; d++) {
+		pinMode(pins[d], OUTPUT);
+		digitalWrite(pins[d], HIGH);
+		txPort[d] = portOutputRegister(digitalPinToPort(pins[d]));
+		txMask[d] = digitalPinToBitMask(pins[d]);
+	}
+
+	noInterrupts();
+	TCCR2A = _BV(WGM21);							// CTC mode
+	TCCR2B = _BV(CS21);							// clk/8
+	OCR2A = (F_CPU / 8 / LCD_BAUD) - 1;
+	TIMSK2 = _BV(OCIE2A);
+	interrupts();
+}
+
+#ifdef PROFILE
+// micros() counts Timer0 in steps of 4us, so this is good to 64 cycles at 16MHz
+unsigned long halCycles() {
+	return micros() * (F_CPU / 1000000L);
+}
+
+// the USART was powered down by halBegin(); its receive interrupt wakes the idle loop
+void halDebugBegin() {
+	power_usart0_enable();
+	Serial.begin(DEBUG_BAUD);
+}
+
+int halDebugRead() {
+	return Serial.read();
+}
+
+void halDebugWrite(const char* str) {
+	Serial.print(str);
+}
+#endif
+
+// a power-on or brown-out reset took the panels down too; with no record of the
+// cause, assume the worst
+bool halColdStart() {
+	return !(resetFlags & (_BV(EXTRF) | _BV(WDRF))) || (resetFlags & (_BV(PORF) | _BV(BORF)));
+}
+
+// Timer1 keeps the seconds between the sketch's RTC reads
+void halTickBegin(void (*tick)()) {
+	tickHandler = tick;
+	noInterrupts();
+	TCCR1A = 0;
+	TCCR1B = _BV(WGM12) | _BV(CS12);			// CTC on OCR1A, clk/256
+	OCR1A = (tickPeriod >> 16) - 1;
+	TCNT1 = 0;
+	TIFR1 = _BV(OCF1A);
+	TIMSK1 = _BV(OCIE1A);
+	interrupts();
+}
+
+// lengthen (or, negative, shorten) the tick by ppb parts per billion: 4.096 of
+// the 16.16 period per ppb at 16MHz, split to stay within a long
+void halTickTrim(long ppb) {
+	const long k = F_CPU / 15625;
+	uint32_t period = ((uint32_t)TICK_COUNTS << 16) + ppb / 250 * k + ppb % 250 * k / 250;
+	noInterrupts();
+	tickPeriod = period;
+	interrupts();
+}
+
+// microseconds since the last tick; a tick that is due but not yet handled (with
+// interrupts off) shows as a whole tick or more
+unsigned long halTickPhase() {
+	uint16_t count = TCNT1;
+	if (TIFR1 & _BV(OCF1A)) return TICK_US((unsigned long)OCR1A + 1 + TCNT1);
+	return TICK_US((unsigned long)count);
+}
+
+// start a new second now, dropping any tick that is due
+void halTickRestart() {
+	TCNT1 = 0;
+	TIFR1 = _BV(OCF1A);
+}
+
+// each tick is a whole number of counts; carrying the fraction from tick to tick
+// holds the average to the trimmed period. OCR1A is safe to move here, just after
+// the counter has cleared.
+ISR(TIMER1_COMPA_vect) {
+	uint16_t frac = tickFrac + (uint16_t)tickPeriod;
+	OCR1A = (tickPeriod >> 16) - 1 + (frac < tickFrac);
+	tickFrac = frac;
+	if (tickHandler) tickHandler();
+}
+
+// clock one byte out to the DS1302, LSB first; it samples IO on the rising edge
+static void rtcWriteByte(byte b) {
+	*rtcMode |= rtcIo;
+	for (byte i = 0; i < 8; i++, b >>= 1) {
+		if (b & 1) *rtcOut |= rtcIo;
+		else *rtcOut &= ~rtcIo;
+		delayMicroseconds(1);
+		*rtcOut |= rtcSclk;
+		delayMicroseconds(1);
+		*rtcOut &= ~rtcSclk;
+	}
+}
+
+// clock one byte in, LSB first; the DS1302 drives each bit after a falling edge
+static byte rtcReadByte() {
+	byte b = 0;
+	*rtcMode &= ~rtcIo;
+	*rtcOut &= ~rtcIo;
+	for (byte i = 0; i < 8; i++) {
+		delayMicroseconds(1);
+		if (*rtcIn & rtcIo) b |= 1 << i;
+		*rtcOut |= rtcSclk;
+		delayMicroseconds(1);
+		*rtcOut &= ~rtcSclk;
+	}
+	return b;
+}
+
+static byte fromBcd(byte b) {
+	return (b >> 4) * 10 + (b & 0x0F);
+}
+
+static byte toBcd(int v) {
+	return ((v / 10) << 4) | (v % 10);
+}
+
+// read only the seconds register, for finding the instant the RTC's second turns
+// over; -1 if the clock is halted
+int halRtcSecond() {
+	*rtcOut |= rtcCe;
+	delayMicroseconds(4);
+	rtcWriteByte(0x81);
+	byte r = rtcReadByte();
+	*rtcOut &= ~rtcCe;
+	delayMicroseconds(4);
+	return (r & RTC_CH) ? -1 : fromBcd(r);
+}
+
+// one clock burst: seconds, minutes, hours, date, month, day of week, year. Ending
+// the transaction after those skips the control register.
+bool halRtcRead(int* t) {
+	byte r[SZ_RTC];
+
+	*rtcOut |= rtcCe;
+	delayMicroseconds(4);
+	rtcWriteByte(RTC_BURST | 1);
+	for (byte i = 0; i < SZ_RTC; i++) r[i] = rtcReadByte();
+	*rtcOut &= ~rtcCe;
+	delayMicroseconds(4);
+
+	if (r[0] & RTC_CH) return false;
+	t[SECOND] = fromBcd(r[0]);
+	t[MINUTE] = fromBcd(r[1]);
+	t[HOUR] = fromBcd(r[2] & 0x3F);		// 24-hour mode, as written below
+	t[DAY] = fromBcd(r[3]);
+	t[MONTH] = fromBcd(r[4]);
+	t[DOW] = r[5] - 1;
+	t[YEAR] = fromBcd(r[6]);
+
+	// a chip that lost power (or isn't fitted) reads back nonsense
+	return t[SECOND] < 60 && t[MINUTE] < 60 && t[HOUR] < 24 && t[DAY] >= 1 && t[DAY] <= 31
+		&& t[MONTH] >= 1 && t[MONTH] <= 12 && t[YEAR] < 100;
+}
+
+// lift write protection, then set every clock register (clearing clock halt) and
+// restore write protection in one burst
+void halRtcWrite(const int* t) {
+	*rtcOut |= rtcCe;
+	delayMicroseconds(4);
+	rtcWriteByte(RTC_CONTROL);
+	rtcWriteByte(0);
+	*rtcOut &= ~rtcCe;
+	delayMicroseconds(4);
+
+	*rtcOut |= rtcCe;
+	delayMicroseconds(4);
+	rtcWriteByte(RTC_BURST);
+	rtcWriteByte(toBcd(t[SECOND]));
+	rtcWriteByte(toBcd(t[MINUTE]));
+	rtcWriteByte(toBcd(t[HOUR]));
+	rtcWriteByte(toBcd(t[DAY]));
+	rtcWriteByte(toBcd(t[MONTH]));
+	rtcWriteByte(t[DOW] + 1);
+	rtcWriteByte(toBcd(t[YEAR]));
+	rtcWriteByte(RTC_WP);
+	*rtcOut &= ~rtcCe;
+	delayMicroseconds(4);
+	*rtcMode &= ~rtcIo;
+}
+
+bool halButton(int button) {
+	return digitalRead(BUTTON[button]);
+}
+
+static void (*buttonHandler)() = NULL;
+
+// enable the pin-change interrupt of every button pin; the Uno's buttons span
+// two ports, so each port's vector calls the same handler
+void halButtonBegin(void (*change)()) {
+	buttonHandler = change;
+	noInterrupts();
+	for (int b = 0; b < SZ_BUTTON; b++) {
+		*digitalPinToPCMSK(BUTTON[b]) |= _BV(digitalPinToPCMSKbit(BUTTON[b]));
+		*digitalPinToPCICR(BUTTON[b]) |= _BV(digitalPinToPCICRbit(BUTTON[b]));
+	}
+	interrupts();
+}
+
+ISR(PCINT0_vect) {
+	if (buttonHandler) buttonHandler();
+}
+
+ISR(PCINT1_vect, ISR_ALIASOF(PCINT0_vect));
+ISR(PCINT2_vect, ISR_ALIASOF(PCINT0_vect));
+
+void halEepromRead(int addr, void* buf, int size) {
+	eeprom_read_block(buf, (const void*)addr, size);
+}
+
+// eeprom_update_block() reads each byte first and only erases and writes those that
+// differ, which saves both wear and the 3.3ms a write takes
+void halEepromUpdate(int addr, const void* buf, int size) {
+	eeprom_update_block(buf, (void*)addr, size);
+}
+
+// the Timer2 interrupt drains the queue on its own, so there is nothing to do
+void halTxWait(int disp) {
+}
+
+// the transmitter turns its interrupt off when there is nothing to send
+void halTxStart() {
+	TIMSK2 |= _BV(OCIE2A);
+}
+
+// idle mode keeps Timer0 (millis), Timer1 (the tick) and Timer2 (the transmitter)
+// running; power-down would stop all three. Enabling interrupts and sleeping are
+// back to back, so an interrupt in between still wakes the loop.
+void halSleep() {
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	sleep_enable();
+	interrupts();
+	sleep_cpu();
+	sleep_disable();
+}
+
+// Timer2 sends one bit per panel per tick (8N1, LSB first). After a command the
+// line is held idle for TX_CMDIDLE bit times to let the SerLCD act on it. Once
+// every panel is idle with nothing queued the interrupt switches itself off, so
+// it doesn't wake the sleeping loop 9600 times a second.
+ISR(TIMER2_COMPA_vect) {
+	bool busy = false;
+	for (byte d = 0; d < SZ_PORT; d++) {
+		if (!txBits[d]) {
+			if (txIdle[d]) {
+				txIdle[d]--;
+				busy = true;
+				continue;
+			}
+			int b = lcdNext(d);
+			if (b < 0) continue;
+
+			txShift[d] = 0x200 | ((uint16_t)b << 1);
+			txBits[d] = 10;
+			if (txCmd[d]) txIdle[d] = TX_CMDIDLE;
+			txCmd[d] = !txCmd[d] && (b == 0xFE || b == 0x7C);
+		}
+
+		if (txShift[d] & 1) *txPort[d] |= txMask[d];
+		else *txPort[d] &= ~txMask[d];
+		txShift[d] >>= 1;
+		txBits[d]--;
+		busy = true;
+	}
+	if (!busy) TIMSK2 &= ~_BV(OCIE2A);
+}
+
+#endif
@@ -0,0 +1,37 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file stands in for the Arduino core in the Linux host build: only the
+ * types, macros and functions the sketch itself uses. Everything else goes
+ * through HAL.h.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+
+// flash and RAM are the same thing here
+#define PROGMEM
+#define PSTR(s) (s)
+#define memcpy_P memcpy
+
+#define INPUT		0x0
+#define OUTPUT		0x1
+#define LOW			0x0
+#define HIGH		0x1
+
+// implemented in hal_native.cpp, on virtual time
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void delay(unsigned long ms);
+unsigned long millis();
+unsigned long micros();
+void noInterrupts();
+void interrupts();
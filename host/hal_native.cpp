@@ -0,0 +1,364 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file implements the hardware abstraction layer for the Linux host build.
+ * Virtual time only moves when the sketch delays, sleeps or uses the RTC bus, or
+ * when simAdvance()/simTick() is called; the Timer1 tick and the RTC's seconds
+ * fire as it passes them. The LCDs are drained synchronously by simDrain().
+ */
+
+#include <deque>
+#include <time.h>
+#include "Arduino.h"
+#include "../HAL.h"
+#include "../IO.h"
+#include "hal_native.h"
+
+byte simEeprom[SIM_EEPROM];
+unsigned long simEepromWrites[SIM_EEPROM];
+
+// EEPROM starts out blank, as on a new chip
+static struct eepromErase {
+	eepromErase() { memset(simEeprom, 0xFF, sizeof(simEeprom)); }
+} eepromErase;
+
+// a virtual SerLCD: the bytes it received, and the screen they produced
+struct virtualLcd {
+	std::vector<byte> log;
+	char screen[SIM_ROWS][SIM_COLS];
+	int row, col;
+	byte prefix;									// pending 0xFE/0x7C command prefix
+	byte cgram[64];								// custom character patterns
+	int cgAddr;										// CGRAM address data goes to, or -1 for the screen
+};
+
+// a virtual DS1302: its clock registers, halted until first written like a chip
+// that has lost power, and when its next second starts
+struct virtualRtc {
+	int t[SZ_TIME];
+	bool running;
+	unsigned long long edge;
+};
+
+// virtual time spent on the 3-wire bus, close to the AVR driver's
+#define SIM_RTC_SECOND	24		// seconds register only
+#define SIM_RTC_READ		140	// clock burst read
+#define SIM_RTC_WRITE	170	// write-protect off, then clock burst write
+
+static virtualLcd lcd[SIM_PANELS];
+static virtualRtc rtc;
+static bool held[SZ_BUTTON];
+static void (*tickHandler)() = NULL;
+static void (*buttonHandler)() = NULL;
+static unsigned long long now = 0;				// virtual time, in microseconds
+static bool coldStart = true;					// the board (and panels) just powered up
+static std::deque<char> debugInput;			// bytes waiting on the debug port
+
+// the Timer1 tick: its period follows the crystal's error and the sketch's trim
+static long driftPpm = 0, trimPpb = 0;
+static double tickPeriod = 1e6, tickLast = 0, tickNext = 0;
+static unsigned long tickCount = 0;
+
+static void advance(unsigned long long us);
+
+// ARDUINO CORE
+
+void pinMode(uint8_t pin, uint8_t mode) {
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+}
+
+int digitalRead(uint8_t pin) {
+	for (int b = 0; b < SZ_BUTTON; b++) {
+		if (BUTTON[b] == pin) return held[b] ? HIGH : LOW;
+	}
+	return LOW;
+}
+
+// the transmitter keeps running while the sketch waits
+void delay(unsigned long ms) {
+	advance(ms * 1000ULL);
+	simDrain();
+}
+
+unsigned long millis() {
+	return now / 1000;
+}
+
+unsigned long micros() {
+	return now;
+}
+
+void noInterrupts() {
+}
+
+void interrupts() {
+}
+
+// HAL
+
+void halBegin() {
+	for (int d = 0; d < SIM_PANELS; d++) {
+		lcd[d].log.clear();
+		memset(lcd[d].screen, ' ', sizeof(lcd[d].screen));
+		lcd[d].row = lcd[d].col = 0;
+		lcd[d].prefix = 0;
+		lcd[d].cgAddr = -1;
+	}
+}
+
+// the probes time the host itself, in ns; the debug port is stdin fed by
+// simDebugInput() and stdout
+unsigned long halCycles() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+void halDebugBegin() {
+}
+
+int halDebugRead() {
+	if (debugInput.empty()) return -1;
+	int c = debugInput.front();
+	debugInput.pop_front();
+	return c;
+}
+
+void halDebugWrite(const char* str) {
+	fputs(str, stdout);
+}
+
+void simDebugInput(char c) {
+	debugInput.push_back(c);
+}
+
+bool halColdStart() {
+	return coldStart;
+}
+
+void simColdStart(bool cold) {
+	coldStart = cold;
+}
+
+void halTickBegin(void (*tick)()) {
+	tickHandler = tick;
+	halTickRestart();
+}
+
+static void tickUpdate() {
+	tickPeriod = 1e6 * (1 + trimPpb * 1e-9) / (1 + driftPpm * 1e-6);
+}
+
+void halTickTrim(long ppb) {
+	trimPpb = ppb;
+	tickUpdate();
+}
+
+// in the oscillator's microseconds, as the timer counts them
+unsigned long halTickPhase() {
+	return (unsigned long)((now - tickLast) * (1 + driftPpm * 1e-6));
+}
+
+void halTickRestart() {
+	tickLast = now;
+	tickNext = now + tickPeriod;
+}
+
+int halRtcSecond() {
+	advance(SIM_RTC_SECOND);
+	return rtc.running ? rtc.t[SECOND] : -1;
+}
+
+bool halRtcRead(int* t) {
+	advance(SIM_RTC_READ);
+	if (!rtc.running) return false;
+	memcpy(t, rtc.t, sizeof(rtc.t));
+	return true;
+}
+
+// writing the clock restarts the chip's count of the second
+void halRtcWrite(const int* t) {
+	advance(SIM_RTC_WRITE);
+	memcpy(rtc.t, t, sizeof(rtc.t));
+	rtc.running = true;
+	rtc.edge = now + 1000000;
+}
+
+bool halButton(int button) {
+	return held[button];
+}
+
+void halButtonBegin(void (*change)()) {
+	buttonHandler = change;
+}
+
+void halEepromRead(int addr, void* buf, int size) {
+	memcpy(buf, simEeprom + addr, size);
+}
+
+// counts the bytes that actually change, as the AVR's update only writes those
+void halEepromUpdate(int addr, const void* buf, int size) {
+	const byte* b = (const byte*)buf;
+	for (int i = 0; i < size; i++) {
+		if (simEeprom[addr + i] != b[i]) {
+			simEeprom[addr + i] = b[i];
+			simEepromWrites[addr + i]++;
+		}
+	}
+}
+
+void halTxWait(int disp) {
+	simDrain();
+}
+
+void halTxStart() {
+}
+
+// sleep until the next interrupt: at the latest Timer0's, at the next millisecond
+void halSleep() {
+	simDrain();
+	advance(1000 - now % 1000);
+}
+
+// SIMULATION CONTROLS
+
+// count the virtual RTC on by one second, carrying through its calendar fields
+static void rtcSecond() {
+	static const int days[] = { 0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	int* t = rtc.t;
+	if (++t[SECOND] < 60) return;
+	t[SECOND] = 0;
+	if (++t[MINUTE] < 60) return;
+	t[MINUTE] = 0;
+	if (++t[HOUR] < 24) return;
+	t[HOUR] = 0;
+	t[DOW] = (t[DOW] + 1) % 7;
+	if (++t[DAY] <= days[t[MONTH]] + (t[MONTH] == 2 && t[YEAR] % 4 == 0)) return;
+	t[DAY] = 1;
+	if (++t[MONTH] <= 12) return;
+	t[MONTH] = 1;
+	t[YEAR] = (t[YEAR] + 1) % 100;
+}
+
+// move virtual time on, counting RTC seconds and firing ticks in the order they fall
+static void advance(unsigned long long us) {
+	unsigned long long end = now + us;
+	for (;;) {
+		bool rtcDue = rtc.running && rtc.edge <= end;
+		bool tickDue = tickHandler && tickNext <= end;
+		if (rtcDue && (!tickDue || rtc.edge <= tickNext)) {
+			now = rtc.edge;
+			rtcSecond();
+			rtc.edge += 1000000;
+		}
+		else if (tickDue) {
+			now = (unsigned long long)tickNext;
+			tickLast = tickNext;
+			tickNext += tickPeriod;
+			tickCount++;
+			tickHandler();
+		}
+		else break;
+	}
+	now = end;
+}
+
+// run up to and including the next tick
+void simTick() {
+	if (tickHandler) advance((unsigned long long)tickNext + 1 - now);
+	else advance(1000000);
+}
+
+unsigned long simTicks() {
+	return tickCount;
+}
+
+void simDrift(long ppm) {
+	driftPpm = ppm;
+	tickUpdate();
+}
+
+void simRtcPeek(int* t, unsigned long* us) {
+	memcpy(t, rtc.t, sizeof(rtc.t));
+	*us = (unsigned long)(now + 1000000 - rtc.edge);
+}
+
+// a change raises the pin-change interrupt, as on the board
+void simPress(int button, bool state) {
+	if (held[button] == state) return;
+	held[button] = state;
+	if (buttonHandler) buttonHandler();
+}
+
+void simAdvance(unsigned long ms) {
+	advance(ms * 1000ULL);
+}
+
+// apply one received byte to a virtual LCD the way a SerLCD would; for LCD_WARMUP
+// after power-on it is busy with its own splash and ignores input
+static void receive(virtualLcd* v, byte b) {
+	v->log.push_back(b);
+	if (coldStart && now < LCD_WARMUP * 1000ULL) return;
+
+	if (v->prefix == 0xFE) {
+		if (b == 0x01) {
+			memset(v->screen, ' ', sizeof(v->screen));
+			v->row = v->col = 0;
+			v->cgAddr = -1;
+		}
+		else if (b & 0x80) {
+			v->row = (b & 0x40) ? 1 : 0;
+			v->col = b & 0x3F;
+			v->cgAddr = -1;
+		}
+		else if (b & 0x40) v->cgAddr = b & 0x3F;
+		v->prefix = 0;
+		return;
+	}
+	// 0x7C commands (backlight, splash) don't change the screen contents
+	if (v->prefix == 0x7C) {
+		v->prefix = 0;
+		return;
+	}
+	if (b == 0xFE || b == 0x7C) {
+		v->prefix = b;
+		return;
+	}
+
+	if (v->cgAddr >= 0) {
+		v->cgram[v->cgAddr] = b;
+		v->cgAddr = (v->cgAddr + 1) & 0x3F;
+		return;
+	}
+
+	// like the HD44780, writes past the end of a row go nowhere visible
+	if (v->col < SIM_COLS) v->screen[v->row][v->col] = b;
+	v->col++;
+}
+
+void simDrain() {
+	for (int d = 0; d < SIM_PANELS; d++) {
+		for (int b = lcdNext(d); b >= 0; b = lcdNext(d)) receive(&lcd[d], b);
+	}
+}
+
+const std::vector<byte>& simLog(int disp) {
+	return lcd[disp].log;
+}
+
+void simClearLog() {
+	for (int d = 0; d < SIM_PANELS; d++) lcd[d].log.clear();
+}
+
+const byte* simCgram(int disp) {
+	return lcd[disp].cgram;
+}
+
+void simScreen(int disp, int row, char* out) {
+	memcpy(out, lcd[disp].screen[row], SIM_COLS);
+	out[SIM_COLS] = '\0';
+}
@@ -0,0 +1,35 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file declares the controls the host build adds on top of the HAL: an
+ * in-memory EEPROM, a virtual RTC, a virtual one-second tick and buttons, and
+ * virtual LCDs that record every byte they receive and keep a copy of what they
+ * would show.
+ */
+
+#include <vector>
+
+#define SIM_EEPROM	1024	// bytes of EEPROM on an Uno
+#define SIM_PANELS	2
+#define SIM_ROWS		2
+#define SIM_COLS		16
+
+// EEPROM contents, blank (0xFF) at start
+extern byte simEeprom[SIM_EEPROM];
+extern unsigned long simEepromWrites[SIM_EEPROM];	// writes each byte has taken, for wear
+
+void simDebugInput(char c);					// a byte arriving on the debug serial port
+void simColdStart(bool cold);				// boot as from power-on (the default) or a reset
+void simTick();									// run virtual time up to and through the next tick
+unsigned long simTicks();						// ticks fired so far
+void simDrift(long ppm);						// make the crystal behind Timer1 fast (or slow) by ppm
+void simRtcPeek(int* t, unsigned long* us);	// RTC fields, and microseconds into its second, off the bus
+void simPress(int button, bool held);		// hold or release a button
+void simAdvance(unsigned long ms);			// move virtual time forward
+void simDrain();									// deliver every queued byte to the virtual LCDs
+const std::vector<byte>& simLog(int disp);	// bytes received by a virtual LCD
+void simClearLog();
+void simScreen(int disp, int row, char* out);	// copy a row of a virtual LCD (NUL-terminated)
+const byte* simCgram(int disp);				// the 8 custom characters of a virtual LCD, 8 rows each
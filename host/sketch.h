@@ -0,0 +1,13 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file compiles the whole sketch into a host program. Include it once, after
+ * any system headers, since the sketch headers define short macros such as DAY
+ * and OK. Link the program against hal_native.o.
+ */
+
+#include "Arduino.h"
+#include "hal_native.h"
+#include "../WorldClock.ino"
@@ -0,0 +1,337 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * tzconv: the clock's conversions as a thread-safe host library. The sketch keeps
+ * its clock in globals, so it is only run while the transition caches are built,
+ * once, inside a function-local static; every lookup after that reads the caches.
+ * convAllZones() lays each UTC year out zones-across on first use, under a
+ * once_flag per year.
+ */
+
+#include <stdlib.h>
+#include <strings.h>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CONV_X86
+#endif
+#include "tzconv.h"
+#include "sketch.h"
+
+#define CONV_YEARS		100		// UTC years from CONV_FIRST to CONV_LAST
+#define CONV_SLOTS		4		// transitions one zone may have in one year
+
+static_assert(CONV_LANES >= SZ_ZONES && CONV_LANES % 8 == 0, "CONV_LANES must cover SZ_ZONES in whole AVX2 vectors");
+
+// one stretch of a zone's time with the same offset and DST flag
+struct convSpan {
+	int64_t from;							// unix seconds it starts at
+	int32_t offset;
+	bool dst;
+};
+
+// one UTC year of every zone, zones across: the offset and DST flag in force at the
+// start of the year, then after each of up to CONV_SLOTS transitions; unused slots
+// never arrive and repeat the state before them
+struct convYear {
+	int32_t at[CONV_SLOTS][CONV_LANES];		// seconds into the year
+	int32_t offset[CONV_SLOTS + 1][CONV_LANES];
+	int32_t dst[CONV_SLOTS + 1][CONV_LANES];
+	bool fits;										// no zone needed more than CONV_SLOTS
+};
+
+// every zone's spans from CONV_FIRST to CONV_LAST, each list ending in a sentinel
+// span that starts at CONV_LAST, plus the zone names and the zones-across years
+struct convTables {
+	std::vector<convSpan> spans[SZ_ZONES];
+	std::string name[SZ_ZONES];
+	int64_t yearStart[CONV_YEARS + 1];
+	convYear* year[CONV_YEARS];
+	std::once_flag yearOnce[CONV_YEARS];
+	int kernel;
+	convTables();
+};
+
+// the sketch's state only changes at a history record, a year boundary (when
+// updateDst() moves on) or a DS_* transition, so asking zoneOffset() at each of
+// those instants gives every span exactly
+convTables::convTables() {
+	char buf[64];
+	for (int z = 0; z < SZ_ZONES; z++) {
+		name[z] = tzLocation(z, buf, sizeof(buf));
+
+		std::vector<epoch_t> at;
+		zoneCursor zc;
+		seekZone(z, &zc);
+		while (!zc.rules) {
+			stepZone(&zc);
+			at.push_back(zc.from);
+		}
+
+		int ds = LOADBYTE(TZ_DST + z);
+		long standard = tzOffset(z);
+		epoch_t end = CONV_LAST - CONV_FIRST;
+		for (int yy = 0; yy < CONV_YEARS; yy++) {
+			int t[SZ_TIME] = { yy, 1, 1, 0, 0, 0, 0 };
+			utc = encodeTime(t);
+			at.push_back(utc);
+			if (ds == DS_NONE) continue;
+			updateDst();
+			// the window is in local standard time
+			int64_t start = (int64_t)dsStart[ds] - standard, finish = (int64_t)dsFinish[ds] - standard;
+			if (start >= 0 && start < end) at.push_back(start);
+			if (finish >= 0 && finish < end) at.push_back(finish);
+		}
+		std::sort(at.begin(), at.end());
+		at.erase(std::unique(at.begin(), at.end()), at.end());
+
+		seekZone(z, &zc);
+		for (size_t i = 0; i < at.size(); i++) {
+			bool dst;
+			utc = at[i];
+			updateDst();
+			long offset = zoneOffset(z, &zc, &dst);
+			std::vector<convSpan>& s = spans[z];
+			if (!s.empty() && s.back().offset == offset && s.back().dst == dst) continue;
+			convSpan span = { CONV_FIRST + at[i], (int32_t)offset, dst };
+			s.push_back(span);
+		}
+		convSpan sentinel = { CONV_LAST, 0, false };
+		spans[z].push_back(sentinel);
+	}
+
+	for (int y = 0; y <= CONV_YEARS; y++) {
+		int t[SZ_TIME] = { y, 1, 1, 0, 0, 0, 0 };
+		yearStart[y] = CONV_FIRST + encodeTime(t);
+		if (y < CONV_YEARS) year[y] = NULL;
+	}
+	kernel = CONV_SCALAR;
+	#ifdef CONV_X86
+	kernel = __builtin_cpu_supports("avx2") ? CONV_AVX2 : CONV_SSE2;
+	#endif
+}
+
+static convTables& tables() {
+	static convTables t;
+	return t;
+}
+
+// the span of a zone's list in force at t
+static size_t findSpan(const std::vector<convSpan>& s, int64_t t) {
+	return std::upper_bound(s.begin(), s.end(), t, [](int64_t v, const convSpan& span) {
+		return v < span.from;
+	}) - s.begin() - 1;
+}
+
+// lay one year out zones across
+static convYear* buildYear(const convTables& tt, int y) {
+	convYear* cy = new convYear;
+	int64_t start = tt.yearStart[y], end = tt.yearStart[y + 1];
+	cy->fits = true;
+	for (int z = 0; z < CONV_LANES; z++) {
+		const convSpan* s = NULL;
+		size_t at = 0, last = 0;
+		if (z < SZ_ZONES) {
+			s = tt.spans[z].data();
+			at = findSpan(tt.spans[z], start);
+			for (last = at; s[last + 1].from < end; last++);
+		}
+		if (last - at > CONV_SLOTS) cy->fits = false;
+		for (int slot = 0; slot <= CONV_SLOTS; slot++) {
+			size_t i = std::min(at + slot, last);
+			cy->offset[slot][z] = s ? s[i].offset : 0;
+			cy->dst[slot][z] = s ? s[i].dst : 0;
+			if (slot < CONV_SLOTS) cy->at[slot][z] = at + slot < last ? s[at + slot + 1].from - start : INT32_MAX;
+		}
+	}
+	return cy;
+}
+
+// the kernels: for each slot, lanes whose transition has come take the state after it;
+// then the day shift from where the UTC second of the day lands once offset
+static void allScalar(const convYear* cy, int32_t rel, int32_t sod, convAll* out) {
+	for (int z = 0; z < CONV_LANES; z++) {
+		int32_t offset = cy->offset[0][z], dst = cy->dst[0][z];
+		for (int slot = 0; slot < CONV_SLOTS; slot++) {
+			if (rel >= cy->at[slot][z]) {
+				offset = cy->offset[slot + 1][z];
+				dst = cy->dst[slot + 1][z];
+			}
+		}
+		int32_t local = sod + offset;
+		out->offset[z] = offset;
+		out->dst[z] = dst;
+		out->dayShift[z] = (local >= SECS_DAY) - (local < 0);
+	}
+}
+
+#ifdef CONV_X86
+static void allSse2(const convYear* cy, int32_t rel, int32_t sod, convAll* out) {
+	const __m128i t = _mm_set1_epi32(rel), day = _mm_set1_epi32(SECS_DAY - 1), zero = _mm_setzero_si128();
+	const __m128i second = _mm_set1_epi32(sod);
+	for (int z = 0; z < CONV_LANES; z += 4) {
+		__m128i offset = _mm_loadu_si128((const __m128i*)&cy->offset[0][z]);
+		__m128i dst = _mm_loadu_si128((const __m128i*)&cy->dst[0][z]);
+		for (int slot = 0; slot < CONV_SLOTS; slot++) {
+			// lanes still waiting for this transition keep what they have
+			__m128i wait = _mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)&cy->at[slot][z]), t);
+			offset = _mm_or_si128(_mm_and_si128(wait, offset),
+				_mm_andnot_si128(wait, _mm_loadu_si128((const __m128i*)&cy->offset[slot + 1][z])));
+			dst = _mm_or_si128(_mm_and_si128(wait, dst),
+				_mm_andnot_si128(wait, _mm_loadu_si128((const __m128i*)&cy->dst[slot + 1][z])));
+		}
+		__m128i local = _mm_add_epi32(second, offset);
+		__m128i shift = _mm_sub_epi32(_mm_cmpgt_epi32(zero, local), _mm_cmpgt_epi32(local, day));
+		_mm_storeu_si128((__m128i*)&out->offset[z], offset);
+		_mm_storeu_si128((__m128i*)&out->dst[z], dst);
+		_mm_storeu_si128((__m128i*)&out->dayShift[z], shift);
+	}
+}
+
+__attribute__((target("avx2")))
+static void allAvx2(const convYear* cy, int32_t rel, int32_t sod, convAll* out) {
+	const __m256i t = _mm256_set1_epi32(rel), day = _mm256_set1_epi32(SECS_DAY - 1), zero = _mm256_setzero_si256();
+	const __m256i second = _mm256_set1_epi32(sod);
+	for (int z = 0; z < CONV_LANES; z += 8) {
+		__m256i offset = _mm256_loadu_si256((const __m256i*)&cy->offset[0][z]);
+		__m256i dst = _mm256_loadu_si256((const __m256i*)&cy->dst[0][z]);
+		for (int slot = 0; slot < CONV_SLOTS; slot++) {
+			__m256i wait = _mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)&cy->at[slot][z]), t);
+			offset = _mm256_blendv_epi8(_mm256_loadu_si256((const __m256i*)&cy->offset[slot + 1][z]), offset, wait);
+			dst = _mm256_blendv_epi8(_mm256_loadu_si256((const __m256i*)&cy->dst[slot + 1][z]), dst, wait);
+		}
+		__m256i local = _mm256_add_epi32(second, offset);
+		__m256i shift = _mm256_sub_epi32(_mm256_cmpgt_epi32(zero, local), _mm256_cmpgt_epi32(local, day));
+		_mm256_storeu_si256((__m256i*)&out->offset[z], offset);
+		_mm256_storeu_si256((__m256i*)&out->dst[z], dst);
+		_mm256_storeu_si256((__m256i*)&out->dayShift[z], shift);
+	}
+}
+#endif
+
+int convZones() {
+	return SZ_ZONES;
+}
+
+int convFind(const char* name) {
+	const convTables& t = tables();
+	for (int z = 0; z < SZ_ZONES; z++) {
+		if (strcasecmp(t.name[z].c_str(), name) == 0) return z;
+	}
+	char* end;
+	long z = strtol(name, &end, 10);
+	if (*name && !*end && z >= 0 && z < SZ_ZONES) return z;
+	return -1;
+}
+
+const char* convName(int zone) {
+	return tables().name[zone].c_str();
+}
+
+size_t convTransitions(int zone) {
+	return tables().spans[zone].size() - 1;
+}
+
+void convStart(int zone, convCursor* cur) {
+	tables();
+	cur->zone = zone;
+	cur->at = 0;
+	cur->dayStart = 0;
+}
+
+bool convToLocal(int64_t t, convCursor* cur, convLocal* out) {
+	if (t < CONV_FIRST || t >= CONV_LAST) return false;
+	const std::vector<convSpan>& s = tables().spans[cur->zone];
+
+	// logs mostly run forward: stay in the span, or step into the next one
+	size_t at = cur->at;
+	if (t < s[at].from || t >= s[at + 1].from) {
+		if (t >= s[at + 1].from && at + 2 < s.size() && t < s[at + 2].from) at++;
+		else at = findSpan(s, t);
+		cur->at = at;
+	}
+
+	// the clock can't show local times outside its own range either
+	int64_t local = t + s[at].offset;
+	if (local < CONV_FIRST || local >= CONV_LAST) return false;
+
+	// decode the date once per local day
+	int64_t secs = (local - CONV_FIRST) % SECS_DAY;
+	if (local - secs != cur->dayStart) {
+		int lt[SZ_TIME];
+		cur->dayStart = local - secs;
+		decodeTime(cur->dayStart - CONV_FIRST, lt);
+		cur->year = 2000 + lt[YEAR];
+		cur->month = lt[MONTH];
+		cur->day = lt[DAY];
+		cur->dow = lt[DOW];
+	}
+
+	out->year = cur->year;
+	out->month = cur->month;
+	out->day = cur->day;
+	out->dow = cur->dow;
+	out->hour = secs / 3600;
+	out->minute = secs / 60 % 60;
+	out->second = secs % 60;
+	out->offset = s[at].offset;
+	out->dst = s[at].dst;
+	return true;
+}
+
+bool convAllZones(int64_t t, convAll* out) {
+	if (t < CONV_FIRST || t >= CONV_LAST) return false;
+	convTables& tt = tables();
+
+	// the year from its average length, then put right
+	int y = (t - CONV_FIRST) / 31557600;
+	while (y > 0 && t < tt.yearStart[y]) y--;
+	while (t >= tt.yearStart[y + 1]) y++;
+	std::call_once(tt.yearOnce[y], [&tt, y]() { tt.year[y] = buildYear(tt, y); });
+	const convYear* cy = tt.year[y];
+
+	int32_t rel = t - tt.yearStart[y], sod = (t - CONV_FIRST) % SECS_DAY;
+	if (!cy->fits) {
+		// too many transitions in one year for the slots: look each zone up instead
+		for (int z = 0; z < CONV_LANES; z++) {
+			const convSpan* s = z < SZ_ZONES ? &tt.spans[z][findSpan(tt.spans[z], t)] : NULL;
+			out->offset[z] = s ? s->offset : 0;
+			out->dst[z] = s ? s->dst : 0;
+			out->dayShift[z] = (sod + out->offset[z] >= SECS_DAY) - (sod + out->offset[z] < 0);
+		}
+		return true;
+	}
+
+	switch (tt.kernel) {
+	#ifdef CONV_X86
+	case CONV_AVX2: allAvx2(cy, rel, sod, out); break;
+	case CONV_SSE2: allSse2(cy, rel, sod, out); break;
+	#endif
+	default: allScalar(cy, rel, sod, out);
+	}
+	return true;
+}
+
+int convKernel(int kernel) {
+	convTables& tt = tables();
+	#ifdef CONV_X86
+	if (kernel >= CONV_AVX2 && !__builtin_cpu_supports("avx2")) kernel = CONV_SSE2;
+	tt.kernel = std::min(kernel, (int)CONV_AVX2);
+	#else
+	tt.kernel = CONV_SCALAR;
+	#endif
+	return tt.kernel;
+}
+
+int64_t convFromCivil(int year, int month, int day, int hour, int minute, int second) {
+	if (year < 2000 || year > 2099 || month < 1 || month > 12 || day < 1 || hour < 0 || hour > 23
+		|| minute < 0 || minute > 59 || second < 0 || second > 60) return -1;
+	if (day > monthDays(month, year - 2000)) return -1;
+	int t[SZ_TIME] = { year - 2000, month, day, 0, hour, minute, second };
+	return CONV_FIRST + encodeTime(t);
+}
@@ -0,0 +1,64 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file declares tzconv, the clock's zone table and conversions packaged as a
+ * host library (libtzconv.a) for post-processing logs. Each zone's transitions
+ * are worked out once, by running the sketch's own zoneOffset() at every instant
+ * its answer can change, so the library agrees with the clock by construction.
+ * After that the tables are read-only: any number of threads may convert at once,
+ * each with its own cursors. It doesn't pull in the sketch headers, so it can be
+ * included anywhere.
+ *
+ * convAllZones() answers for every zone at once, for dashboards and checks that
+ * show them all: the spans of each UTC year are laid out as a struct of arrays,
+ * zones across, and a vector kernel (AVX2, SSE2 or plain C) picks each zone's
+ * offset and DST flag with a compare and blend per transition slot.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CONV_FIRST	946684800LL		// 1 JAN 2000, in unix seconds: the clock's epoch
+#define CONV_LAST		4102444800LL	// 1 JAN 2100: the end of two-digit years
+#define CONV_LANES	152				// SZ_ZONES rounded up to whole AVX2 vectors
+
+// the all-zones kernels, best first; convKernel() falls back to one the CPU has
+#define CONV_AVX2		2
+#define CONV_SSE2		1
+#define CONV_SCALAR	0
+
+// a zone's local time at one instant
+struct convLocal {
+	int year, month, day, hour, minute, second;	// year in full
+	int dow;									// 0 for Sunday
+	int32_t offset;						// seconds east of UTC
+	bool dst;
+};
+
+// a reader's place in one zone's transitions, and the local day it last decoded;
+// keep one per zone per thread, set up by convStart()
+struct convCursor {
+	int zone;
+	size_t at;								// transition in effect at the last instant
+	int64_t dayStart;						// unix seconds of the cached local midnight
+	int year, month, day, dow;
+};
+
+// every zone at one instant, one lane per zone (lanes past convZones() are padding)
+struct convAll {
+	int32_t offset[CONV_LANES];			// seconds east of UTC
+	int32_t dst[CONV_LANES];				// 1 in DST
+	int32_t dayShift[CONV_LANES];		// local date less the UTC date: -1, 0 or 1
+};
+
+int convZones();								// number of zones (SZ_ZONES)
+int convFind(const char* name);				// zone by TZ_LOC name (the abbreviation) or number, or -1
+const char* convName(int zone);
+size_t convTransitions(int zone);			// size of the zone's transition cache
+void convStart(int zone, convCursor* cur);
+bool convToLocal(int64_t t, convCursor* cur, convLocal* out);	// false outside CONV_FIRST-CONV_LAST
+bool convAllZones(int64_t t, convAll* out);	// false outside CONV_FIRST-CONV_LAST
+int convKernel(int kernel);					// pick the convAllZones() kernel, before any threads use it
+int64_t convFromCivil(int year, int month, int day, int hour, int minute, int second);	// -1 outside 2000-2099
@@ -0,0 +1,372 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * tzsweep checks the clock against the system zoneinfo database: for every zone
+ * in timezones.h (mapped to a zoneinfo name by tzBuilder/zones.data) and every
+ * minute of the requested years, the offset and DST flag from zoneOffset() must
+ * match the TZif data, and the fields from decodeTime() must match an independent
+ * civil-date conversion (hourly, or every step with -x).
+ *
+ * The answers come from the C library (localtime_r() with TZ naming the zone's
+ * file, and gmtime_r()), not from tzif.cpp: tzBuilder generates timezones.h with
+ * that reader, so a bug in it would have the tables and the check agree.
+ *
+ * The zone-years are dealt out to one forked worker per core. The sketch keeps
+ * its clock state in globals, as firmware does, so each worker gets a private
+ * copy of it for free. Mismatches are merged into runs and reported per zone;
+ * the exit status is 1 if there were any.
+ *
+ * usage: tzsweep [-f first] [-l last] [-j jobs] [-s minutes] [-z abbr] [-x] [-v]
+ *                [-d zoneinfo-dir] [-m zones.data]
+ */
+
+#include <poll.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "sketch.h"
+
+#define UNIX_2000		946684800LL		// the clock's epoch in unix seconds
+#define SHOW_RUNS		5					// runs listed per zone without -v
+
+// a zone as the clock knows it, and the zoneinfo file it stands for
+struct sweepZone {
+	std::string abbr, name;
+	std::string path;				// empty when -z leaves the zone out
+};
+
+// zoneinfo's offset at an instant, and how long it lasts
+struct sweepState {
+	int32_t utoff;
+	bool isdst;
+	int64_t until;				// first instant with a different state
+};
+
+// a stretch of consecutive minutes where the clock and zoneinfo disagree the same way
+struct mismatch {
+	int zone;
+	int64_t from, to;				// unix seconds, to is exclusive
+	int32_t clockOff, zoneOff;
+	bool clockDst, zoneDst;
+	bool fields;					// offsets agree but decodeTime() fields don't
+};
+
+static std::vector<sweepZone> zones;
+static int firstYear = 2015, lastYear = 2044, step = 1;
+static bool everyField = false, verbose = false;
+
+static bool loadZones(const char* mapPath, const char* dir, const char* only) {
+	FILE* f = fopen(mapPath, "r");
+	if (!f) {
+		perror(mapPath);
+		return false;
+	}
+
+	char line[256], abbr[64], name[192];
+	int index = 0;
+	zones.resize(SZ_ZONES);
+	while (fgets(line, sizeof(line), f) && index < SZ_ZONES) {
+		if (sscanf(line, "%63s %191s", abbr, name) != 2) continue;
+		sweepZone* z = &zones[index++];
+		z->abbr = abbr;
+		z->name = name;
+		if (only && z->abbr != only) continue;
+
+		// the C library quietly takes UTC for a zone it can't read, so check first
+		std::string path = std::string(dir) + "/" + name;
+		FILE* file = fopen(path.c_str(), "rb");
+		char magic[4];
+		bool ok = file && fread(magic, 1, 4, file) == 4 && !memcmp(magic, "TZif", 4);
+		if (file) fclose(file);
+		if (!ok) {
+			fprintf(stderr, "tzsweep: can't load %s\n", path.c_str());
+			fclose(f);
+			return false;
+		}
+		z->path = path;
+	}
+	fclose(f);
+
+	if (index != SZ_ZONES) {
+		fprintf(stderr, "tzsweep: %s maps %d zones, timezones.h has %d\n", mapPath, index, SZ_ZONES);
+		return false;
+	}
+	return true;
+}
+
+static int64_t unixYear(int year) {
+	struct tm tm;
+	memset(&tm, 0, sizeof(tm));
+	tm.tm_year = year - 1900;
+	tm.tm_mday = 1;
+	return timegm(&tm);
+}
+
+static void useZone(const sweepZone* zone) {
+	setenv("TZ", (":" + zone->path).c_str(), 1);
+	tzset();
+}
+
+static void probe(int64_t t, int32_t* utoff, bool* isdst) {
+	time_t tt = t;
+	struct tm tm;
+	localtime_r(&tt, &tm);
+	*utoff = tm.tm_gmtoff;
+	*isdst = tm.tm_isdst > 0;
+}
+
+// the state at t and when it ends (by limit at the latest): zoneinfo never changes
+// twice within an hour, so step an hour at a time and bisect the hour it changes in
+static void lookup(int64_t t, int64_t limit, sweepState* state) {
+	probe(t, &state->utoff, &state->isdst);
+	for (int64_t at = t; ; at += 3600) {
+		int32_t utoff;
+		bool isdst;
+		int64_t next = at + 3600;
+		if (next >= limit) {
+			state->until = limit;
+			return;
+		}
+		probe(next, &utoff, &isdst);
+		if (utoff == state->utoff && isdst == state->isdst) continue;
+
+		while (next - at > 1) {
+			int64_t mid = at + (next - at) / 2;
+			probe(mid, &utoff, &isdst);
+			if (utoff == state->utoff && isdst == state->isdst) at = mid;
+			else next = mid;
+		}
+		state->until = next;
+		return;
+	}
+}
+
+// sweep one zone through one year, sending each mismatched run down the pipe
+static unsigned long long sweepYear(int z, int year, int out) {
+	int64_t last = unixYear(year + 1);
+	unsigned long long checked = 0;
+	mismatch run;
+	bool open = false;
+	sweepState state;
+	state.until = INT64_MIN;
+	useZone(&zones[z]);
+	int lt[SZ_TIME];
+	zoneCursor zc;
+	seekZone(z, &zc);
+
+	for (int64_t t = unixYear(year); t < last; t += 60 * step) {
+		if (t >= state.until || state.until == INT64_MIN) lookup(t, last, &state);
+
+		utc = t - UNIX_2000;
+		updateDst();
+		bool dst;
+		long off = zoneOffset(z, &zc, &dst);
+
+		bool bad = (off != state.utoff || dst != state.isdst), fields = false;
+		if (!bad && (everyField || t % 3600 == 0)) {
+			time_t local = t + off;
+			struct tm tm;
+			gmtime_r(&local, &tm);
+			decodeTime(utc + off, lt);
+			fields = (lt[YEAR] != tm.tm_year - 100 || lt[MONTH] != tm.tm_mon + 1 || lt[DAY] != tm.tm_mday
+				|| lt[DOW] != tm.tm_wday || lt[HOUR] != tm.tm_hour || lt[MINUTE] != tm.tm_min
+				|| lt[SECOND] != tm.tm_sec);
+			bad = fields;
+		}
+		checked++;
+
+		// extend the open run if this minute disagrees the same way
+		if (open && (!bad || run.clockOff != off || run.zoneOff != state.utoff
+			|| run.clockDst != dst || run.zoneDst != state.isdst || run.fields != fields)) {
+			if (write(out, &run, sizeof(run)) != sizeof(run)) exit(2);
+			open = false;
+		}
+		if (bad && !open) {
+			run.zone = z;
+			run.from = t;
+			run.clockOff = off;
+			run.zoneOff = state.utoff;
+			run.clockDst = dst;
+			run.zoneDst = state.isdst;
+			run.fields = fields;
+			open = true;
+		}
+		if (open) run.to = t + 60 * step;
+	}
+	if (open && write(out, &run, sizeof(run)) != sizeof(run)) exit(2);
+	return checked;
+}
+
+// worker: every jobs-th zone-year starting at its own index, then a trailer
+// record with the number of instants checked
+static void worker(int index, int jobs, int out) {
+	unsigned long long checked = 0;
+	int years = lastYear - firstYear + 1, unit = 0;
+
+	for (int z = 0; z < SZ_ZONES; z++) {
+		if (zones[z].path.empty()) continue;
+		for (int y = 0; y < years; y++, unit++) {
+			if (unit % jobs == index) checked += sweepYear(z, firstYear + y, out);
+		}
+	}
+
+	mismatch trailer;
+	memset(&trailer, 0, sizeof(trailer));
+	trailer.zone = -1;
+	trailer.from = checked;
+	if (write(out, &trailer, sizeof(trailer)) != sizeof(trailer)) exit(2);
+}
+
+static bool runOrder(const mismatch& a, const mismatch& b) {
+	if (a.zone != b.zone) return a.zone < b.zone;
+	return a.from < b.from;
+}
+
+static const char* stamp(int64_t t, char* buf) {
+	time_t tt = t;
+	struct tm tm;
+	gmtime_r(&tt, &tm);
+	sprintf(buf, "%04d-%02d-%02d %02d:%02dZ", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min);
+	return buf;
+}
+
+static const char* offset(int32_t off, bool dst, char* buf) {
+	int a = off < 0 ? -off : off;
+	sprintf(buf, "%c%02d:%02d%s", off < 0 ? '-' : '+', a / 3600, a / 60 % 60, dst ? " DST" : "    ");
+	return buf;
+}
+
+static void report(std::vector<mismatch>& runs) {
+	char from[32], to[32], clock[16], zone[16];
+	std::sort(runs.begin(), runs.end(), runOrder);
+
+	// runs split at a zone-year boundary join back up
+	std::vector<mismatch> merged;
+	for (size_t r = 0; r < runs.size(); r++) {
+		mismatch* prev = merged.empty() ? NULL : &merged.back();
+		if (prev && prev->zone == runs[r].zone && prev->to == runs[r].from
+			&& prev->clockOff == runs[r].clockOff && prev->zoneOff == runs[r].zoneOff
+			&& prev->clockDst == runs[r].clockDst && prev->zoneDst == runs[r].zoneDst
+			&& prev->fields == runs[r].fields) prev->to = runs[r].to;
+		else merged.push_back(runs[r]);
+	}
+	runs.swap(merged);
+
+	for (size_t r = 0; r < runs.size(); ) {
+		int z = runs[r].zone;
+		size_t end = r;
+		long long minutes = 0;
+		while (end < runs.size() && runs[end].zone == z) minutes += (runs[end].to - runs[end].from) / 60, end++;
+
+		printf("%-6s %-32s %5zu runs %9lld minutes\n", zones[z].abbr.c_str(), zones[z].name.c_str(), end - r, minutes);
+		for (size_t i = r; i < end && (verbose || i - r < SHOW_RUNS); i++) {
+			const mismatch* m = &runs[i];
+			printf("    %s - %s  clock %s  zoneinfo %s%s\n", stamp(m->from, from), stamp(m->to, to),
+				offset(m->clockOff, m->clockDst, clock), offset(m->zoneOff, m->zoneDst, zone),
+				m->fields ? "  (decodeTime fields)" : "");
+		}
+		if (!verbose && end - r > SHOW_RUNS) printf("    ... %zu more\n", end - r - SHOW_RUNS);
+		r = end;
+	}
+}
+
+int main(int argc, char** argv) {
+	const char* dir = "/usr/share/zoneinfo";
+	const char* map = "../tzBuilder/zones.data";
+	const char* only = NULL;
+	int jobs = sysconf(_SC_NPROCESSORS_ONLN);
+
+	int opt;
+	while ((opt = getopt(argc, argv, "f:l:j:s:z:xvd:m:")) != -1) {
+		switch (opt) {
+		case 'f': firstYear = atoi(optarg); break;
+		case 'l': lastYear = atoi(optarg); break;
+		case 'j': jobs = atoi(optarg); break;
+		case 's': step = atoi(optarg); break;
+		case 'z': only = optarg; break;
+		case 'x': everyField = true; break;
+		case 'v': verbose = true; break;
+		case 'd': dir = optarg; break;
+		case 'm': map = optarg; break;
+		default:
+			fprintf(stderr, "usage: tzsweep [-f first] [-l last] [-j jobs] [-s minutes] [-z abbr] [-x] [-v]\n"
+				"               [-d zoneinfo-dir] [-m zones.data]\n");
+			return 2;
+		}
+	}
+	// the clock counts 32-bit seconds from 2000
+	if (firstYear < 2000 || lastYear > 2135 || lastYear < firstYear) {
+		fprintf(stderr, "tzsweep: years must fall within 2000-2135\n");
+		return 2;
+	}
+	if (jobs < 1) jobs = 1;
+	if (step < 1) step = 1;
+	if (!loadZones(map, dir, only)) return 2;
+
+	struct timespec start, finish;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	std::vector<pollfd> pipes(jobs);
+	for (int j = 0; j < jobs; j++) {
+		int fd[2];
+		if (pipe(fd) != 0) {
+			perror("pipe");
+			return 2;
+		}
+		pid_t pid = fork();
+		if (pid == 0) {
+			close(fd[0]);
+			worker(j, jobs, fd[1]);
+			_exit(0);
+		}
+		close(fd[1]);
+		pipes[j].fd = fd[0];
+		pipes[j].events = POLLIN;
+	}
+
+	// collect runs from every worker as they arrive, so none blocks on a full pipe
+	std::vector<mismatch> runs;
+	unsigned long long checked = 0;
+	int open = jobs;
+	while (open) {
+		poll(pipes.data(), pipes.size(), -1);
+		for (int j = 0; j < jobs; j++) {
+			if (pipes[j].fd < 0 || !pipes[j].revents) continue;
+			mismatch m;
+			ssize_t got = read(pipes[j].fd, &m, sizeof(m));
+			if (got == sizeof(m)) {
+				if (m.zone < 0) checked += m.from;
+				else runs.push_back(m);
+				continue;
+			}
+			close(pipes[j].fd);
+			pipes[j].fd = -1;
+			open--;
+		}
+	}
+	int failed = 0, status;
+	while (wait(&status) > 0) {
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failed++;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &finish);
+
+	report(runs);
+	int bad = 0;
+	for (size_t r = 0; r < runs.size(); r++) {
+		if (r == 0 || runs[r].zone != runs[r - 1].zone) bad++;
+	}
+	printf("%llu instants in %d-%d checked by %d workers in %.2fs: %d of %d zones mismatched\n",
+		checked, firstYear, lastYear, jobs,
+		(finish.tv_sec - start.tv_sec) + (finish.tv_nsec - start.tv_nsec) / 1e9,
+		bad, only ? 1 : SZ_ZONES);
+	if (failed) {
+		fprintf(stderr, "tzsweep: %d workers failed\n", failed);
+		return 2;
+	}
+	return bad ? 1 : 0;
+}
@@ -0,0 +1,200 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * wcbench times the conversion and DST hot paths of the clock core on the host:
+ * every zone in timezones.h at every minute of a year, plus one display frame
+ * per minute broken down by phase. With -c it also estimates AVR cycles, by
+ * scaling host cycles (measured against a dependent add chain) by -k, the
+ * typical cost of the same 16/32-bit work on an 8-bit core without a divider,
+ * and from those the share of each second the sleeping loop would be awake.
+ *
+ * usage: wcbench [-y YY] [-s minutes] [-c] [-k scale]
+ */
+
+#include <chrono>
+#include <unistd.h>
+#include "sketch.h"
+
+typedef std::chrono::steady_clock benchClock;
+
+// AVR clock and rough per-interrupt costs (entry, body, exit) for the duty estimate
+#define AVR_HZ			16000000.0
+#define AVR_TXBIT		70		// Timer2 transmitter, per bit time while sending
+#define AVR_MILLIS	60		// Timer0 overflow, once every 1.024 ms, plus the loop pass it wakes
+
+static volatile long sink;			// keeps results alive past the optimizer
+static int year = 15, step = 1;
+static bool cycles = false;
+static double scale = 8.0, ghz = 0.0;
+
+static double sinceNs(benchClock::time_point start) {
+	return std::chrono::duration<double, std::nano>(benchClock::now() - start).count();
+}
+
+// host cycles per nanosecond, from a chain of adds that can't overlap
+static double hostGhz() {
+	const long n = 100000000;
+	unsigned long x = 0;
+	benchClock::time_point start = benchClock::now();
+	for (long i = 0; i < n; i++) {
+		x += i;
+		asm volatile("" : "+r"(x));
+	}
+	double ns = sinceNs(start);
+	sink = x;
+	return n / ns;
+}
+
+static void printHeader() {
+	printf("%-24s %12s %10s %14s", "benchmark", "ops", "ns/op", "ops/s");
+	if (cycles) printf(" %14s", "avr cycles/op");
+	printf("\n");
+}
+
+static void report(const char* name, unsigned long long ops, double ns) {
+	printf("%-24s %12llu %10.2f %14.0f", name, ops, ns / ops, ops / ns * 1e9);
+	if (cycles) printf(" %14.0f", ns / ops * ghz * scale);
+	printf("\n");
+}
+
+static epoch_t startOfYear(int y) {
+	int t[SZ_TIME] = { y, 1, 1, 0, 0, 0, 0 };
+	return encodeTime(t);
+}
+
+// the loops below visit every zone at every step-th minute of the year
+#define EACH_MINUTE(m) for (epoch_t m = first; m < last; m += 60L * step)
+#define EACH_ZONE(z) for (int z = 0; z < SZ_ZONES; z++)
+
+static void benchConversions() {
+	epoch_t first = startOfYear(year), last = startOfYear(year + 1);
+	unsigned long long ops = 0;
+	long acc = 0;
+	int lt[SZ_TIME];
+	zoneSnap zs;
+	static zoneCursor zc[SZ_ZONES];
+	bool dst;
+	benchClock::time_point start;
+
+	// decodeTime() is what normalizeDateTime() became: one decode per zone
+	start = benchClock::now();
+	EACH_MINUTE(m) {
+		EACH_ZONE(z) {
+			decodeTime(m + tzOffset(z), lt);
+			acc += lt[DAY];
+		}
+		ops += SZ_ZONES;
+	}
+	report("decodeTime", ops, sinceNs(start));
+
+	ops = 0;
+	start = benchClock::now();
+	EACH_MINUTE(m) {
+		utc = m;
+		updateDst();
+		EACH_ZONE(z) acc += zoneOffset(z, &zc[z], &dst) + dst;
+		ops += SZ_ZONES;
+	}
+	report("zoneOffset", ops, sinceNs(start));
+
+	// the snapshot replaced isNextDay()/isPrevDay(): convert, then compare days
+	ops = 0;
+	start = benchClock::now();
+	EACH_MINUTE(m) {
+		utc = m;
+		updateDst();
+		snapZone(tz[TZ_LOCAL], &snap[TZ_LOCAL], &snapCursor[TZ_LOCAL]);
+		EACH_ZONE(z) {
+			snapZone(z, &zs, &zc[z]);
+			acc += daySymbol(&zs);
+		}
+		ops += SZ_ZONES;
+	}
+	report("snapZone+daySymbol", ops, sinceNs(start));
+
+	sink = acc;
+}
+
+static void benchFrames() {
+	epoch_t first = startOfYear(year), last = startOfYear(year + 1);
+	unsigned long long frames = 0, bytes = 0;
+	double ns[3] = { 0, 0, 0 }, overhead;
+	const char* phase[3] = { "takeSnapshot", "composeFrame", "flushDisp" };
+	benchClock::time_point start;
+
+	// cost of reading the clock itself, taken off every phase
+	start = benchClock::now();
+	for (int i = 0; i < 1000000; i++) sink = benchClock::now().time_since_epoch().count();
+	overhead = sinceNs(start) / 1000000;
+
+	EACH_MINUTE(m) {
+		realtime = utc = m;
+		updateDst();
+
+		start = benchClock::now();
+		takeSnapshot();
+		ns[0] += sinceNs(start) - overhead;
+
+		start = benchClock::now();
+		composeFrame();
+		ns[1] += sinceNs(start) - overhead;
+
+		start = benchClock::now();
+		flushDisp(LCD0);
+		flushDisp(LCD1);
+		ns[2] += sinceNs(start) - overhead;
+
+		simDrain();
+		bytes += simLog(LCD0).size() + simLog(LCD1).size();
+		simClearLog();
+		frames++;
+	}
+
+	printf("\nper frame (%llu frames, %.1f bytes/frame on the wire)\n", frames, (double)bytes / frames);
+	printHeader();
+	for (int p = 0; p < 3; p++) report(phase[p], frames, ns[p]);
+	report("updateDisp total", frames, ns[0] + ns[1] + ns[2]);
+
+	// the loop sleeps between ticks, so at one frame a second it is awake for the
+	// frame, the bits on the wire (a byte is 10 bit times, plus command idles) and
+	// Timer0's wakeups
+	if (cycles) {
+		double frame = (ns[0] + ns[1] + ns[2]) / frames * ghz * scale;
+		double wire = (double)bytes / frames * 10 * AVR_TXBIT;
+		double timer0 = 1000 / 1.024 * AVR_MILLIS;
+		printf("\nestimated awake time at 1 frame/s: %.2f%% (frame %.2f%%, transmitter %.2f%%, millis %.2f%%)\n",
+			(frame + wire + timer0) / AVR_HZ * 100, frame / AVR_HZ * 100, wire / AVR_HZ * 100, timer0 / AVR_HZ * 100);
+	}
+}
+
+int main(int argc, char** argv) {
+	int opt;
+	while ((opt = getopt(argc, argv, "y:s:ck:")) != -1) {
+		switch (opt) {
+		case 'y': year = atoi(optarg); break;
+		case 's': step = atoi(optarg); break;
+		case 'c': cycles = true; break;
+		case 'k': scale = atof(optarg); break;
+		default:
+			fprintf(stderr, "usage: wcbench [-y YY] [-s minutes] [-c] [-k scale]\n");
+			return 1;
+		}
+	}
+	if (step < 1) step = 1;
+
+	setup();
+	simDrain();
+	simClearLog();
+
+	if (cycles) {
+		ghz = hostGhz();
+		printf("host %.2f cycles/ns, AVR estimate scale %.1f\n", ghz, scale);
+	}
+	printf("%d zones, every %d minute(s) of 20%02d\n\n", SZ_ZONES, step, year);
+	printHeader();
+	benchConversions();
+	benchFrames();
+	return 0;
+}
@@ -0,0 +1,107 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * wccfg checks the EEPROM config store against the in-memory EEPROM: a blank chip
+ * loads the defaults; saves go round the ring and the newest always loads back,
+ * with the sequence number wrapping past 0xFFFF on the way; the saves wear every
+ * slot alike; and a newest slot that was cut short (a bad CRC, or a header never
+ * written) falls back to the record before it. Each reload is loadConfig() from
+ * scratch, as at boot. The exit status is 1 if any check failed.
+ *
+ * usage: wccfg [-n laps]
+ */
+
+#include <unistd.h>
+#include "sketch.h"
+
+static int failed = 0;
+
+static void expect(bool ok, const char* what, int save) {
+	if (ok) return;
+	printf("wccfg: %s (save %d)\n", what, save);
+	failed++;
+}
+
+// the n-th config saved: zone 1 and its label change every time, so no save is skipped
+static void saveNth(int n) {
+	tz[1] = n % SZ_ZONES;
+	tzLabel[1][0] = 'A' + n % 26;
+	saveConfig();
+}
+
+// reload as at boot, and check the n-th config is what came back
+static bool loadsNth(int n) {
+	tz[1] = -1;
+	tzLabel[1][0] = '\0';
+	loadConfig();
+	return tz[1] == n % SZ_ZONES && tzLabel[1][0] == 'A' + n % 26;
+}
+
+static int slotAddr(int slot) {
+	return CFG_BASE + slot * sizeof(configRecord);
+}
+
+int main(int argc, char** argv) {
+	int laps = 3;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "n:")) != -1) {
+		switch (opt) {
+		case 'n': laps = atoi(optarg); break;
+		default:
+			fprintf(stderr, "usage: wccfg [-n laps]\n");
+			return 2;
+		}
+	}
+	if (laps < 1) laps = 1;
+
+	// a blank chip holds no record, so the defaults apply
+	loadConfig();
+	expect(tz[0] == TZ_PST && tz[1] == TZ_JST && !strcmp(tzLabel[0], "Calif"), "blank EEPROM didn't load the defaults", 0);
+
+	// start the count just short of wrapping, so it wraps partway round the first lap
+	config.seq = 0xFFFF - CFG_SLOTS / 2;
+	int saves = laps * CFG_SLOTS;
+	for (int n = 0; n < saves; n++) {
+		saveNth(n);
+		expect(cfgSlot == n % CFG_SLOTS, "save went to the wrong slot", n);
+		expect(loadsNth(n), "newest save didn't load", n);
+	}
+	printf("%d saves over %d slots of %d bytes, sequence %u to %u\n", saves, (int)CFG_SLOTS,
+		(int)sizeof(configRecord), (unsigned int)(0xFFFF - CFG_SLOTS / 2 + 1), config.seq);
+
+	// every slot took its share of the writes
+	unsigned long least = ~0UL, most = 0;
+	for (unsigned int s = 0; s < CFG_SLOTS; s++) {
+		unsigned long w = simEepromWrites[slotAddr(s) + offsetof(configRecord, seq)];
+		if (w < least) least = w;
+		if (w > most) most = w;
+	}
+	printf("writes per slot: %lu to %lu\n", least, most);
+	expect(most - least <= 1, "wear is uneven across the slots", saves);
+
+	// a save cut short after its header: the CRC fails, so the one before loads
+	int newest = cfgSlot, last = saves - 1;
+	simEeprom[slotAddr(newest) + offsetof(configRecord, label)] ^= 0x20;
+	expect(loadsNth(last - 1), "corrupt newest slot didn't fall back to the previous save", last);
+	expect(cfgSlot == (newest + CFG_SLOTS - 1) % CFG_SLOTS, "fallback loaded the wrong slot", last);
+
+	// the next save goes over the corrupt slot and is the newest again
+	saveNth(saves);
+	expect(cfgSlot == newest, "save after a fallback went to the wrong slot", saves);
+	expect(loadsNth(saves), "save after a fallback didn't load", saves);
+
+	// a save cut short before its header was written falls back the same way
+	simEeprom[slotAddr(newest)] = 0xFF;
+	expect(loadsNth(last - 1), "headerless newest slot didn't fall back to the previous save", saves);
+
+	// with every record damaged, the defaults apply
+	for (unsigned int s = 0; s < CFG_SLOTS; s++) simEeprom[slotAddr(s) + offsetof(configRecord, crc)] ^= 0xFF;
+	loadConfig();
+	expect(tz[1] == TZ_JST, "fully corrupt EEPROM didn't load the defaults", saves);
+
+	printf("%s\n", failed ? "FAILED" : "ok");
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,285 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * wcconv rewrites the timestamps in a log into one of the clock's zones, using
+ * libtzconv, so a log reads the way the clock would have shown it. The timestamp
+ * is the field-th whitespace-separated field of each line (the first by default)
+ * and may be unix seconds or ISO-8601 with Z or a numeric offset, either with a
+ * fraction, which is kept. It becomes ISO-8601 local time with the zone's offset;
+ * any other field, and any timestamp outside 2000-2099, passes through untouched.
+ *
+ * Input is read in large blocks and parsed where it lies; each block is cut at
+ * line ends into one part per job, converted by its own thread with its own
+ * cursor, and written back in order. -b reports the throughput on stderr.
+ *
+ * usage: wcconv -z zone [-f field] [-j jobs] [-b] [file ...]
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <thread>
+#include <vector>
+#include "tzconv.h"
+
+#define CONV_BLOCK		(4 << 20)	// bytes of input per job per pass
+#define CONV_GROWTH		3				// output bytes per input byte, at worst
+
+static int zone = -1, field = 1, jobs = 1;
+static bool bench = false;
+
+// one job's share of a block
+struct convPart {
+	const char* in;
+	const char* end;
+	std::vector<char> out;
+	size_t used;
+	unsigned long long lines, converted;
+	convCursor cur;
+};
+
+static const char DIGITS[] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+static inline char* put2(char* o, int v) {
+	memcpy(o, DIGITS + 2 * v, 2);
+	return o + 2;
+}
+
+static inline bool isDigit(char c) {
+	return c >= '0' && c <= '9';
+}
+
+// value of n digits, or -1 if any isn't one
+static inline int number(const char* p, int n) {
+	int v = 0;
+	for (int i = 0; i < n; i++) {
+		if (!isDigit(p[i])) return -1;
+		v = v * 10 + p[i] - '0';
+	}
+	return v;
+}
+
+// parse the timestamp in [p, end): unix seconds, or ISO-8601 with Z or +-hh[:]mm;
+// the fraction, if any, is returned as [*frac, *fracEnd)
+static bool parseStamp(const char* p, const char* end, int64_t* t, const char** frac, const char** fracEnd) {
+	const char* q = p;
+	bool iso = end - p >= 20 && p[4] == '-' && p[7] == '-' && p[10] == 'T' && p[13] == ':' && p[16] == ':';
+	if (iso) {
+		int year = number(p, 4), month = number(p + 5, 2), day = number(p + 8, 2);
+		int hour = number(p + 11, 2), minute = number(p + 14, 2), second = number(p + 17, 2);
+		if ((year | month | day | hour | minute | second) < 0) return false;
+		*t = convFromCivil(year, month, day, hour, minute, second);
+		if (*t < 0) return false;
+		q = p + 19;
+	}
+	else {
+		int64_t v = 0;
+		while (q < end && isDigit(*q) && q - p < 11) v = v * 10 + *q++ - '0';
+		if (q == p) return false;
+		*t = v;
+	}
+
+	*frac = *fracEnd = q;
+	if (q < end && *q == '.') {
+		for (q++; q < end && isDigit(*q); q++);
+		*fracEnd = q;
+	}
+	// unix seconds end there; ISO-8601 goes on to its offset
+	if (!iso) return q == end;
+	if (end - q == 1 && *q == 'Z') return true;
+	if ((end - q == 6 || end - q == 5) && (*q == '+' || *q == '-')) {
+		int hh = number(q + 1, 2), mm = number(end - 2, 2);
+		if (hh < 0 || mm < 0 || (end - q == 6 && q[3] != ':')) return false;
+		long off = hh * 3600L + mm * 60;
+		*t -= *q == '+' ? off : -off;
+		return true;
+	}
+	return false;
+}
+
+// ISO-8601 local time of the cursor's zone, with the fraction copied across
+static char* formatLocal(char* o, const convLocal* l, const char* frac, const char* fracEnd) {
+	o = put2(o, l->year / 100);
+	o = put2(o, l->year % 100);
+	*o++ = '-';
+	o = put2(o, l->month);
+	*o++ = '-';
+	o = put2(o, l->day);
+	*o++ = 'T';
+	o = put2(o, l->hour);
+	*o++ = ':';
+	o = put2(o, l->minute);
+	*o++ = ':';
+	o = put2(o, l->second);
+	memcpy(o, frac, fracEnd - frac);
+	o += fracEnd - frac;
+	int32_t off = l->offset;
+	*o++ = off < 0 ? '-' : '+';
+	if (off < 0) off = -off;
+	o = put2(o, off / 3600);
+	*o++ = ':';
+	return put2(o, off / 60 % 60);
+}
+
+// convert one part line by line; unchanged runs are copied in one go
+static void convertPart(convPart* part) {
+	const char* p = part->in;
+	const char* copied = p;
+	part->out.resize((part->end - part->in) * CONV_GROWTH + 64);
+	char* o = part->out.data();
+
+	while (p < part->end) {
+		const char* eol = (const char*)memchr(p, '\n', part->end - p);
+		if (!eol) eol = part->end;
+		part->lines++;
+
+		// find the field: skip leading blanks, then field-1 fields and the blanks after them
+		const char* f = p;
+		for (int n = 0; ; n++) {
+			while (f < eol && (*f == ' ' || *f == '\t')) f++;
+			if (n + 1 == field || f == eol) break;
+			while (f < eol && *f != ' ' && *f != '\t') f++;
+		}
+		const char* e = f;
+		while (e < eol && *e != ' ' && *e != '\t' && *e != '\r') e++;
+
+		int64_t t;
+		const char *frac, *fracEnd;
+		convLocal l;
+		if (e > f && parseStamp(f, e, &t, &frac, &fracEnd) && convToLocal(t, &part->cur, &l)) {
+			memcpy(o, copied, f - copied);
+			o += f - copied;
+			o = formatLocal(o, &l, frac, fracEnd);
+			copied = e;
+			part->converted++;
+		}
+		p = eol + 1;
+	}
+	memcpy(o, copied, part->end - copied);
+	o += part->end - copied;
+	part->used = o - part->out.data();
+}
+
+static bool writeAll(const char* p, size_t n) {
+	while (n) {
+		ssize_t w = write(1, p, n);
+		if (w <= 0) return false;
+		p += w;
+		n -= w;
+	}
+	return true;
+}
+
+// stream one file through the parts, a block at a time
+static bool convertFile(int fd, std::vector<convPart>& parts, std::vector<char>& buf,
+	unsigned long long* bytes) {
+	size_t have = 0;
+	bool eof = false;
+	while (!eof || have) {
+		while (!eof && have < buf.size()) {
+			ssize_t r = read(fd, buf.data() + have, buf.size() - have);
+			if (r < 0) return false;
+			if (r == 0) eof = true;
+			have += r;
+		}
+		*bytes += have;
+
+		// everything up to the last line end, or the rest at the end of the file
+		size_t cut = have;
+		if (!eof) {
+			while (cut && buf[cut - 1] != '\n') cut--;
+			if (!cut) cut = have;			// a line longer than the buffer goes through as is
+		}
+		*bytes -= have - cut;
+
+		// one part per job, each ending on a line end
+		const char* p = buf.data();
+		const char* end = p + cut;
+		size_t used = 0;
+		for (int j = 0; j < jobs; j++) {
+			const char* stop = j + 1 == jobs ? end : p + (end - p) / (jobs - j);
+			while (stop < end && (stop == p || stop[-1] != '\n')) stop++;
+			parts[j].in = p;
+			parts[j].end = stop;
+			p = stop;
+			if (parts[j].end > parts[j].in) used = j + 1;
+		}
+
+		std::vector<std::thread> threads;
+		for (size_t j = 1; j < used; j++) threads.emplace_back(convertPart, &parts[j]);
+		if (used) convertPart(&parts[0]);
+		for (size_t j = 0; j < threads.size(); j++) threads[j].join();
+		for (size_t j = 0; j < used; j++) {
+			if (!writeAll(parts[j].out.data(), parts[j].used)) return false;
+		}
+
+		memmove(buf.data(), buf.data() + cut, have - cut);
+		have -= cut;
+	}
+	return true;
+}
+
+int main(int argc, char** argv) {
+	int opt;
+	bool usage = false;
+	while ((opt = getopt(argc, argv, "z:f:j:b")) != -1) {
+		switch (opt) {
+		case 'z':
+			zone = convFind(optarg);
+			if (zone < 0) {
+				fprintf(stderr, "wcconv: no zone %s\n", optarg);
+				return 2;
+			}
+			break;
+		case 'f': field = atoi(optarg); break;
+		case 'j': jobs = atoi(optarg); break;
+		case 'b': bench = true; break;
+		default: usage = true;
+		}
+	}
+	if (usage || zone < 0 || field < 1) {
+		fprintf(stderr, "usage: wcconv -z zone [-f field] [-j jobs] [-b] [file ...]\n");
+		return 2;
+	}
+	if (jobs < 1) jobs = 1;
+
+	std::vector<convPart> parts(jobs);
+	for (int j = 0; j < jobs; j++) {
+		parts[j].lines = parts[j].converted = 0;
+		convStart(zone, &parts[j].cur);
+	}
+	std::vector<char> buf((size_t)CONV_BLOCK * jobs);
+
+	struct timespec start, finish;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	unsigned long long bytes = 0;
+	int status = 0;
+	for (int a = optind; a < argc || a == optind; a++) {
+		const char* name = a < argc ? argv[a] : "-";
+		int fd = strcmp(name, "-") ? open(name, O_RDONLY) : 0;
+		if (fd < 0 || !convertFile(fd, parts, buf, &bytes)) {
+			perror(name);
+			status = 1;
+		}
+		if (fd > 0) close(fd);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &finish);
+
+	if (bench) {
+		unsigned long long lines = 0, converted = 0;
+		for (int j = 0; j < jobs; j++) lines += parts[j].lines, converted += parts[j].converted;
+		double secs = (finish.tv_sec - start.tv_sec) + (finish.tv_nsec - start.tv_nsec) / 1e9;
+		fprintf(stderr, "wcconv: %llu of %llu lines converted to %s (%zu transitions), %.1f MB in %.3fs"
+			" by %d jobs: %.1fM stamps/s, %.0f MB/s\n", converted, lines, convName(zone),
+			convTransitions(zone), bytes / 1e6, secs, jobs, converted / secs / 1e6, bytes / secs / 1e6);
+	}
+	return status;
+}
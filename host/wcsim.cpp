@@ -0,0 +1,191 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * wcsim runs the clock on the host: it boots the sketch on a blank virtual EEPROM
+ * (so with the default config), runs its loop through one-second ticks, and
+ * prints what the two panels show along with the bytes sent to them. With -x the
+ * crystal behind the tick is off by that many ppm, to watch the calibration
+ * against the RTC pull it back in. The first line times the boot phases; -w boots
+ * as after a reset, with the panels already on and set up, rather than a power-up.
+ *
+ * -a starts in the alternate view, and -V in any view (pressing OK that many times).
+ * A view change must never fill a transmit queue: if one makes lcdWrite() wait,
+ * wcsim says so and exits with status 1.
+ *
+ * usage: wcsim [-n ticks] [-d "YY MM DD hh mm ss"] [-x ppm] [-a | -V view] [-w] [-v]
+ */
+
+#include <unistd.h>
+#include "sketch.h"
+
+// stand-in for a custom character, from the shape of its pattern: solid, bars at
+// the top, bottom or both, or blank
+static char customChar(int disp, int code) {
+	const byte* rows = simCgram(disp) + (code & 7) * 8;
+	bool top = rows[0], bottom = rows[7], middle = rows[3] && rows[4];
+	if (middle) return '#';
+	if (top && bottom) return '=';
+	if (top) return '~';
+	if (bottom) return '_';
+	return ' ';
+}
+
+// stand-ins for the LCD's own symbols, as drawn in layouts.md
+static char printable(int disp, char c) {
+	if ((byte)c < 0x10) return customChar(disp, c);
+	switch ((byte)c) {
+	case SYM_LINE: return '#';
+	case BIG_COLON: return ':';
+	case SYM_NEXTDAY: return '-';
+	case SYM_PREVDAY: return '.';
+	case SYM_DST: return '*';
+	}
+	return ((byte)c < 0x20 || (byte)c > 0x7E) ? '?' : c;
+}
+
+// print both panels side by side, as in layouts.md
+static void printPanels() {
+	char row[SIM_PANELS][SIM_COLS + 1];
+
+	printf("+----------------+ +----------------+\n");
+	for (int r = 0; r < SIM_ROWS; r++) {
+		for (int d = 0; d < SIM_PANELS; d++) {
+			simScreen(d, r, row[d]);
+			for (int c = 0; c < SIM_COLS; c++) row[d][c] = printable(d, row[d][c]);
+		}
+		printf("|%s| |%s|\n", row[0], row[1]);
+	}
+	printf("+----------------+ +----------------+\n");
+}
+
+static void loopOnce() {
+	loop();
+	simDrain();
+}
+
+// the boot phases, and when the first frame is on the panels: the sim delivers bytes
+// at once, so that is estimated from the bytes from the clear on at LCD_BAUD
+static void printBoot() {
+	unsigned long frame = 0;
+	for (int d = 0; d < SIM_PANELS; d++) {
+		const std::vector<byte>& log = simLog(d);
+		size_t from = 0;
+		for (size_t i = 0; i + 1 < log.size(); i++) {
+			if (log[i] == 0xFE && log[i + 1] == 0x01) from = i;
+		}
+		if (log.size() - from > frame) frame = log.size() - from;
+	}
+	unsigned long shown = bootTime[BOOT_QUEUED] + frame * 10 * 1000000UL / LCD_BAUD;
+	printf("boot (%s): clock %.1f ms, frame %.1f ms, ready %.1f ms, queued %.1f ms, "
+	       "shown by %.1f ms (%lu bytes)\n", halColdStart() ? "power-on" : "reset",
+	       bootTime[BOOT_CLOCK] / 1000.0, bootTime[BOOT_FRAME] / 1000.0, bootTime[BOOT_READY] / 1000.0,
+	       bootTime[BOOT_QUEUED] / 1000.0, shown / 1000.0, frame);
+}
+
+// how far the clock is ahead of the RTC, in microseconds
+static long clockLead() {
+	int t[SZ_TIME];
+	unsigned long us;
+	simRtcPeek(t, &us);
+	return (int32_t)(realtime - encodeTime(t)) * 1000000L + (long)halTickPhase() - (long)us;
+}
+
+int main(int argc, char** argv) {
+	int ticks = 3, t[SZ_TIME];
+	long drift = 0;
+	int views = 0;
+	bool verbose = false, setTime = false, warm = false;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "n:d:x:aV:wv")) != -1) {
+		switch (opt) {
+		case 'n': ticks = atoi(optarg); break;
+		case 'd':
+			if (sscanf(optarg, "%d %d %d %d %d %d", &t[YEAR], &t[MONTH], &t[DAY],
+			           &t[HOUR], &t[MINUTE], &t[SECOND]) != 6) {
+				fprintf(stderr, "wcsim: -d takes \"YY MM DD hh mm ss\" (UTC)\n");
+				return 1;
+			}
+			setTime = true;
+			break;
+		case 'x': drift = atol(optarg); break;
+		case 'a': views = 1; break;
+		case 'V': views = atoi(optarg); break;
+		case 'w': warm = true; break;
+		case 'v': verbose = true; break;
+		default:
+			fprintf(stderr, "usage: wcsim [-n ticks] [-d \"YY MM DD hh mm ss\"] [-x ppm] [-a | -V view] [-w] [-v]\n");
+			return 1;
+		}
+	}
+
+	simDrift(drift);
+	// a reset rather than a power-up: the panels are already on, and the config says
+	// they hold the splash and backlight
+	if (warm) {
+		simColdStart(false);
+		loadConfig();
+		lcdSetup = LCD_SETUP;
+		saveConfig();
+	}
+	setup();
+	simDrain();
+	printBoot();
+	// set the clock and the RTC, as a button adjustment would
+	if (setTime) {
+		utc = encodeTime(t);
+		setRealtime(utc);
+		updateDst();
+		writeRtc();
+	}
+	// step through the views with OK, leaving each edge clear of the debounce lockout
+	for (int v = 0; v < views; v++) {
+		simAdvance(IO_DEBOUNCE);
+		simPress(OK, true);
+		loopOnce();
+		simAdvance(IO_DEBOUNCE);
+		simPress(OK, false);
+		loopOnce();
+	}
+	// and run until the last one is on the panels
+	simAdvance(IO_DEBOUNCE);
+	loopOnce();
+	if (txStalls) {
+		fprintf(stderr, "wcsim: changing view stalled %u writes (queue high-water %d + %d)\n", txStalls,
+		        txHigh[LCD0], txHigh[LCD1]);
+		return 1;
+	}
+	simDrain();
+	simClearLog();
+
+	unsigned long total[SIM_PANELS] = { 0, 0 };
+	long worst = 0;
+	for (int i = 0; i < ticks; i++) {
+		// run the loop through one tick, sleeping between interrupts as on the board
+		unsigned long n = simTicks();
+		while (simTicks() == n) loop();
+		simDrain();
+		if (i >= ticks / 2 && labs(clockLead()) > worst) worst = labs(clockLead());
+		for (int d = 0; d < SIM_PANELS; d++) total[d] += simLog(d).size();
+		if (verbose) {
+			printf("tick %d: %zu + %zu bytes\n", i + 1, simLog(LCD0).size(), simLog(LCD1).size());
+			printPanels();
+		}
+		simClearLog();
+	}
+
+	if (!verbose) printPanels();
+	printf("%d ticks, %lu + %lu bytes sent, queue high-water %d + %d, %u stalls\n",
+	       ticks, total[LCD0], total[LCD1], txHigh[LCD0], txHigh[LCD1], txStalls);
+	#ifdef PROFILE
+	// ask for the probes over the debug port, as from a terminal
+	simDebugInput('p');
+	loopOnce();
+	#endif
+	printf("clock %+ld us from the RTC (worst %ld us over the second half), trim %+.3f ppm, "
+	       "RTC read every %d min taking %lu us\n",
+	       clockLead(), worst, tickTrim / 1000.0, calInterval, rtcBusMicros);
+	return 0;
+}
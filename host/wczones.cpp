@@ -0,0 +1,140 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * wczones shows every zone of the clock at one instant (now, or -t unix seconds),
+ * from one call to convAllZones(): the UTC date is decoded once and each zone's
+ * date is that plus its day shift.
+ *
+ * With -b it instead runs every kernel over each minute of a year (-y, in full)
+ * and the same instants zone by zone through convToLocal(), checks that they all
+ * agree, and reports the time per instant and per zone.
+ *
+ * usage: wczones [-t seconds] [-k kernel] [-b] [-y year]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <chrono>
+#include "tzconv.h"
+
+typedef std::chrono::steady_clock benchClock;
+
+static const char* KERNEL_NAME[] = { "scalar", "sse2", "avx2" };
+static const char* DOW_NAME[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+static volatile long sink;			// keeps results alive past the optimizer
+
+static double sinceNs(benchClock::time_point start) {
+	return std::chrono::duration<double, std::nano>(benchClock::now() - start).count();
+}
+
+static void show(int64_t t) {
+	convAll all;
+	convCursor cur;
+	convLocal u;
+	if (!convAllZones(t, &all)) {
+		fprintf(stderr, "wczones: %lld is outside 2000-2099\n", (long long)t);
+		exit(2);
+	}
+	convStart(convFind("UTC"), &cur);
+	convToLocal(t, &cur, &u);
+	int sod = u.hour * 3600 + u.minute * 60 + u.second;
+
+	for (int z = 0; z < convZones(); z++) {
+		int32_t off = all.offset[z];
+		int a = off < 0 ? -off : off;
+		int local = ((sod + off) % 86400 + 86400) % 86400;
+		printf("%-6s %02d:%02d %s %c%02d:%02d%s%s\n", convName(z), local / 3600, local / 60 % 60,
+			DOW_NAME[(u.dow + all.dayShift[z] + 7) % 7], off < 0 ? '-' : '+', a / 3600, a / 60 % 60,
+			all.dst[z] ? " DST" : "", all.dayShift[z] ? (all.dayShift[z] > 0 ? " +1 day" : " -1 day") : "");
+	}
+}
+
+static long dayKey(const convLocal* l) {
+	return l->year * 10000L + l->month * 100 + l->day;
+}
+
+static void bench(int year) {
+	int64_t first = convFromCivil(year, 1, 1, 0, 0, 0), last = convFromCivil(year + 1, 1, 1, 0, 0, 0);
+	if (year == 2099) last = CONV_LAST;
+	if (first < 0 || last < 0) {
+		fprintf(stderr, "wczones: years run 2000-2099\n");
+		exit(2);
+	}
+	int zones = convZones();
+	long instants = (last - first) / 60;
+	convAll all;
+	benchClock::time_point start;
+	printf("%d zones, every minute of %d\n\n%-12s %10s %12s %14s\n", zones, year, "method", "instants",
+		"ns/instant", "ns/zone");
+
+	// zone by zone, the reference the kernels must match
+	static convCursor cur[CONV_LANES];
+	static convLocal ref[CONV_LANES];
+	for (int z = 0; z < zones; z++) convStart(z, &cur[z]);
+	long acc = 0;
+	start = benchClock::now();
+	for (int64_t t = first; t < last; t += 60) {
+		for (int z = 0; z < zones; z++) {
+			convToLocal(t, &cur[z], &ref[z]);
+			acc += ref[z].offset + ref[z].day;
+		}
+	}
+	double ns = sinceNs(start);
+	printf("%-12s %10ld %12.1f %14.2f\n", "convToLocal", instants, ns / instants, ns / instants / zones);
+
+	for (int k = CONV_SCALAR; k <= CONV_AVX2; k++) {
+		if (convKernel(k) != k) continue;
+		start = benchClock::now();
+		for (int64_t t = first; t < last; t += 60) {
+			convAllZones(t, &all);
+			acc += all.offset[0];
+		}
+		ns = sinceNs(start);
+		printf("%-12s %10ld %12.1f %14.2f\n", KERNEL_NAME[k], instants, ns / instants, ns / instants / zones);
+
+		// and check every answer, hourly, against the zone-by-zone conversion
+		convCursor uc;
+		convStart(convFind("UTC"), &uc);
+		for (int64_t t = first; t < last; t += 3600) {
+			convLocal u;
+			convAllZones(t, &all);
+			convToLocal(t, &uc, &u);
+			for (int z = 0; z < zones; z++) {
+				if (!convToLocal(t, &cur[z], &ref[z])) continue;	// before 2000 or after 2099 locally
+				int shift = dayKey(&ref[z]) > dayKey(&u) ? 1 : dayKey(&ref[z]) < dayKey(&u) ? -1 : 0;
+				if (all.offset[z] != ref[z].offset || all.dst[z] != ref[z].dst || all.dayShift[z] != shift) {
+					printf("%s disagrees on %s at %lld\n", KERNEL_NAME[k], convName(z), (long long)t);
+					exit(1);
+				}
+			}
+		}
+	}
+	sink = acc;
+}
+
+int main(int argc, char** argv) {
+	int64_t t = time(NULL);
+	int year = 2015;
+	bool timing = false;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "t:k:by:")) != -1) {
+		switch (opt) {
+		case 't': t = atoll(optarg); break;
+		case 'k': convKernel(atoi(optarg)); break;
+		case 'b': timing = true; break;
+		case 'y': year = atoi(optarg); break;
+		default:
+			fprintf(stderr, "usage: wczones [-t seconds] [-k kernel] [-b] [-y year]\n");
+			return 2;
+		}
+	}
+	if (timing) bench(year);
+	else show(t);
+	return 0;
+}
@@ -0,0 +1,119 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file describes the views as tables in flash: each field names what it
+ * shows, where it goes and which zone it is bound to, and composeFrame() walks
+ * the fields of the active view in order. See layouts.md for the views drawn out.
+ */
+
+// field types
+#define FLD_TIME		0		// day symbol, hh:mm and DST symbol of the bound zone
+#define FLD_UTC		1		// day symbol, hh:mm and Z of the bound zone
+#define FLD_LABEL		2		// label of the bound zone
+#define FLD_DATE		3		// DDMMMYY of the bound zone
+#define FLD_DOW		4		// day of the week of the bound zone
+#define FLD_HEART		5		// blanks its cell on odd seconds; put it after the field it blinks
+#define FLD_BIG		6		// hh:mm of the bound zone in big digits, 16 columns over both rows
+
+// zone bindings other than the tz[] slots 0 to SZ_TZ-1
+#define ZONE_UTC		SZ_TZ	// UTC itself
+#define ZONE_NONE		0xFF	// the field shows no zone
+
+// one field of a view: type, panel, row, column and width on it, bound zone
+struct layoutField {
+	byte type, panel, row, col, width, zone;
+};
+
+// fields of every view, one view after the other
+constexpr layoutField LAYOUT_FIELD[] PROGMEM = {
+	// primary: local date, time and UTC, then zones 1 and 2
+	{ FLD_DATE,		LCD0, 0, 0, 7, TZ_LOCAL },
+	{ FLD_DOW,		LCD0, 1, 2, 3, TZ_LOCAL },
+	{ FLD_TIME,		LCD0, 0, 9, 7, TZ_LOCAL },
+	{ FLD_UTC,		LCD0, 1, 9, 7, ZONE_UTC },
+	{ FLD_HEART,	LCD0, 0, 12, 1, ZONE_NONE },
+	{ FLD_TIME,		LCD1, 0, 0, 7, 1 },
+	{ FLD_LABEL,	LCD1, 1, 1, 7, 1 },
+	{ FLD_TIME,		LCD1, 0, 8, 7, 2 },
+	{ FLD_LABEL,	LCD1, 1, 9, 7, 2 },
+	// alternate: zones 3 to 6
+	{ FLD_TIME,		LCD0, 0, 0, 7, 3 },
+	{ FLD_LABEL,	LCD0, 1, 1, 7, 3 },
+	{ FLD_TIME,		LCD0, 0, 8, 7, 4 },
+	{ FLD_LABEL,	LCD0, 1, 9, 7, 4 },
+	{ FLD_TIME,		LCD1, 0, 0, 7, 5 },
+	{ FLD_LABEL,	LCD1, 1, 1, 7, 5 },
+	{ FLD_TIME,		LCD1, 0, 8, 7, 6 },
+	{ FLD_LABEL,	LCD1, 1, 9, 7, 6 },
+	// big: local time across LCD0, and the date and UTC on LCD1
+	{ FLD_BIG,		LCD0, 0, 0, 16, TZ_LOCAL },
+	{ FLD_HEART,	LCD0, 0, 7, 1, ZONE_NONE },
+	{ FLD_HEART,	LCD0, 1, 7, 1, ZONE_NONE },
+	{ FLD_DATE,		LCD1, 0, 0, 7, TZ_LOCAL },
+	{ FLD_LABEL,	LCD1, 0, 9, 7, TZ_LOCAL },
+	{ FLD_DOW,		LCD1, 1, 2, 3, TZ_LOCAL },
+	{ FLD_UTC,		LCD1, 1, 9, 7, ZONE_UTC },
+};
+
+// views, as the index of each one's first field in LAYOUT_FIELD; OK steps through them
+#define SZ_VIEW		3
+#define VIEW_PRIMARY	0
+#define VIEW_ALTERNATE	1
+#define VIEW_BIG		2
+constexpr byte LAYOUT_VIEW[SZ_VIEW + 1] PROGMEM = { 0, 9, 17, 24 };
+
+#define SZ_FIELD		(sizeof(LAYOUT_FIELD) / sizeof(LAYOUT_FIELD[0]))
+
+// true if every field from f on is on a panel that exists and bound to a zone that does,
+// since composeFrame() indexes lcdFrame, the snapshots and tzLabel with them unchecked;
+// only FLD_HEART shows no zone, so only it may be bound to ZONE_NONE
+constexpr bool layoutFits(unsigned int f) {
+	return f >= SZ_FIELD || (LAYOUT_FIELD[f].panel < SZ_LCD
+		&& (LAYOUT_FIELD[f].zone <= ZONE_UTC || (LAYOUT_FIELD[f].type == FLD_HEART && LAYOUT_FIELD[f].zone == ZONE_NONE))
+		&& layoutFits(f + 1));
+}
+
+static_assert(LAYOUT_VIEW[SZ_VIEW] == SZ_FIELD, "LAYOUT_VIEW must end after the last field");
+static_assert(layoutFits(0), "every field's panel must be below SZ_LCD, and its zone a tz[] slot or ZONE_UTC (ZONE_NONE for FLD_HEART only)");
+
+// big digits: eight 5x8 segments in CGRAM, drawn with codes 8-15 (which the HD44780
+// maps onto CGRAM 0-7, and which unlike 0 can sit in a string) and the full block
+#define SZ_GLYPH		8
+#define BIG_CODE		0x08	// code of the first segment
+#define BIG_WIDTH		3		// columns per digit
+#define BIG_LT		(BIG_CODE + 0)	// left upright, rounded top
+#define BIG_UB		(BIG_CODE + 1)	// upper bar
+#define BIG_RT		(BIG_CODE + 2)	// right upright, rounded top
+#define BIG_LL		(BIG_CODE + 3)	// left upright, rounded bottom
+#define BIG_LB		(BIG_CODE + 4)	// lower bar
+#define BIG_LR		(BIG_CODE + 5)	// right upright, rounded bottom
+#define BIG_UMB		(BIG_CODE + 6)	// upper and middle bars
+#define BIG_LMB		(BIG_CODE + 7)	// middle and lower bars
+#define BIG_COLON	0xA5	// centred dot, in both rows
+
+const byte BIG_GLYPH[SZ_GLYPH][8] PROGMEM = {
+	{ 0x07, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F },
+	{ 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F },
+	{ 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x07 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F },
+	{ 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C },
+	{ 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F },
+	{ 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F },
+};
+
+// each digit's top row, then bottom row
+const byte BIG_DIGIT[10][2][BIG_WIDTH] PROGMEM = {
+	{ { BIG_LT, BIG_UB, BIG_RT }, { BIG_LL, BIG_LB, BIG_LR } },
+	{ { BIG_UB, BIG_RT, ' ' }, { BIG_LB, SYM_LINE, BIG_LB } },
+	{ { BIG_UMB, BIG_UMB, BIG_RT }, { BIG_LL, BIG_LB, BIG_LB } },
+	{ { BIG_UMB, BIG_UMB, BIG_RT }, { BIG_LB, BIG_LB, BIG_LR } },
+	{ { BIG_LL, BIG_LB, SYM_LINE }, { ' ', ' ', SYM_LINE } },
+	{ { SYM_LINE, BIG_UMB, BIG_UMB }, { BIG_LB, BIG_LB, BIG_LR } },
+	{ { BIG_LT, BIG_UMB, BIG_UMB }, { BIG_LL, BIG_LB, BIG_LR } },
+	{ { BIG_UB, BIG_UB, BIG_RT }, { ' ', ' ', SYM_LINE } },
+	{ { BIG_LT, BIG_UMB, BIG_RT }, { BIG_LL, BIG_LB, BIG_LR } },
+	{ { BIG_LT, BIG_UMB, BIG_RT }, { ' ', ' ', SYM_LINE } },
+};
@@ -3,26 +3,33 @@
  * This code is licensed under the terms of the GNU General Public License.
  * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
  *
+ * Generated by tzBuilder/tzbuild from tz.data, zones.data and zoneinfo; edit
+ * those and regenerate rather than editing this file.
+ *
  * This header builds the data structures for timezone attributes, including:
  *   TZ_<abbr> Timezone abbreviation for indexing the following arrays
- *   TZ_NAME	The proper name for that timezone
- *   TZ_LOC		Representative location in that timezone
+ *   TZ_POOL	Flash string pool holding every name below, suffixes shared
+ *   TZ_SUFFIX	Offsets into TZ_POOL of the shared suffixes
+ *   TZ_NAME	Offset into TZ_POOL of the proper name for that timezone
+ *   TZ_LOC		Offset into TZ_POOL of a representative location in that timezone
  *   TZ_HOUR	Offset from UTC (hours)
  *   TZ_MIN		Offset from UTC (minutes)
  *   TZ_DST		Which daylight savings rules to apply to this timezone
+ *   TZ_TRANS	Flash records of each timezone's transitions before its current rules
+ *   TZ_TRANS_AT	Offset into TZ_TRANS of each timezone's first record
  *   DS_<name>	Human-readable DST ruleset for indexing into the following arrays
  *   DS_SMON	Numeric month when DST starts
+ *   DS_SWEEK	Week of the month when DST starts (0 for the last week of the previous month)
  *   DS_SDOW	Numeric day of the week when DST starts
  *   DS_FMON	Numeric month when DST finishes
+ *   DS_FWEEK	Week of the month when DST finishes
  *   DS_FDOW	Numeric day of the week when DST finishes
  *   DS_SDAY	Numeric day of the month when DST starts
  *   DS_FDAY	Numeric day of the month when DST finishes
+ *   DS_STIME	Minutes past midnight (local standard time) when DST starts
+ *   DS_FTIME	Minutes past midnight (local standard time) when DST finishes
  */
 
-// macros to simplify reading from PROGMEM arrays
-#define LOADBYTE(x) (byte)pgm_read_byte_near(x)
-#define LOADINT(x) (int)pgm_read_word_near(x)
-
 // timezone name macros
 #define TZ_ZULU	0
 #define TZ_UTC	0
@@ -173,314 +180,620 @@
 #define TZ_NUT	145
 #define TZ_SST	146
 #define TZ_BIT	147
+#define SZ_ZONES	148	// total number of timezones
 
-/* full names take up far too much space -- maybe move to progmem later
-const char* TZ_NAME[] = {
-	"Coordinated Universal Time",
-	"Western European Time",
-	"Central European Time",
-	"Irish Standard Time",
-	"West Africa Time",
-	"Central Africa Time",
-	"Eastern European Time",
-	"Israel Standard Time",
-	"South African Standard Time",
-	"Kaliningrad Time",
-	"Arabia Standard Time",
-	"East Africa Time",
-	"Further-eastern European Time",
-	"Indian Ocean Time",
-	"Moscow Time",
-	"Showa Station Time",
-	"Iran Standard Time",
-	"Armenia Time",
-	"Azerbaijan Time",
-	"Georgia Standard Time",
-	"Gulf Standard Time",
-	"Mauritius Time",
-	"Réunion Time",
-	"Samara Time",
-	"Seychelles Time",
-	"Volgograd Time",
-	"Afghanistan Time",
-	"Heard and McDonald Islands Time",
-	"Mawson Station Time",
-	"Maldives Time",
-	"Oral Time",
-	"Pakistan Standard Time",
-	"Indian/Kerguelen",
-	"Tajikistan Time",
-	"Turkmenistan Time",
-	"Uzbekistan Time",
-	"Yekaterinburg Time",
-	"Indian Standard Time",
-	"Sri Lanka Time",
-	"Nepal Time",
-	"British Indian Ocean Time",
-	"Bangladesh Standard Time",
-	"Bhutan Time",
-	"Kyrgyzstan time",
-	"Omsk Time",
-	"Vostok Station Time",
-	"Cocos Islands Time",
-	"Myanmar Time",
-	"Christmas Island Time",
-	"Davis Time",
-	"Khovd Time",
-	"Indochina Time",
-	"Krasnoyarsk Time",
-	"Thailand Standard Time",
-	"Western Indonesian Time",
-	"ASEAN Common Time",
-	"Australian Western Standard Time",
-	"Brunei Time",
-	"Choibalsan",
-	"Central Indonesia Time",
-	"China time",
-	"Hong Kong Time",
-	"Irkutsk Time",
-	"Malaysia Time",
-	"Philippine Standard Time",
-	"Singapore Time",
-	"Ulaanbaatar Time",
-	"Western Standard Time",
-	"Eastern Indonesian Time",
-	"Japan Standard Time",
-	"Korea Standard Time",
-	"Timor Leste Time",
-	"Yakutsk Time",
-	"Australian Central Standard Time",
-	"Australian Eastern Standard Time",
-	"Chamorro Standard Time",
-	"Chuuk Time",
-	"Dumont d'Urville Time",
-	"Papua New Guinea Time",
-	"Vladivostok Time",
-	"Lord Howe Standard Time",
-	"Kosrae Time",
-	"Macquarie Island Station Time",
-	"New Caledonia Time",
-	"Pohnpei Standard Time",
-	"Sakhalin Island time",
-	"Solomon Islands Time",
-	"Srednekolymsk Time",
-	"Vanuatu Time",
-	"Norfolk Time",
-	"Fiji Time",
-	"Gilbert Island Time",
-	"Magadan Time",
-	"Marshall Islands",
-	"New Zealand Standard Time",
-	"Kamchatka Time",
-	"Tuvalu Time",
-	"Wake Island Time",
-	"Chatham Standard Time",
-	"Phoenix Island Time",
-	"Tokelau Time",
-	"Tonga Time",
-	"Line Islands Time",
-	"Azores Standard Time",
-	"Cape Verde Time",
-	"Eastern Greenland Time",
-	"Fernando de Noronha Time",
-	"South Georgia and the South Sandwich Islands",
-	"Argentina Time",
-	"Brasilia Time",
-	"Falkland Islands Standard Time",
-	"French Guiana Time",
-	"Saint Pierre and Miquelon Standard Time",
-	"Rothera Research Station Time",
-	"Suriname Time",
-	"Uruguay Standard Time",
-	"Newfoundland Time",
-	"Amazon Time",
-	"Atlantic Standard Time",
-	"Bolivia Time",
-	"Chile Standard Time",
-	"Colombia Summer Time",
-	"Eastern Caribbean Time",
-	"Falkland Islands Time",
-	"Guyana Time",
-	"Paraguay Time",
-	"Venezuelan Standard Time",
-	"Colombia Time",
-	"Cuba Standard Time",
-	"Ecuador Time",
-	"Eastern Standard Time",
-	"Peru Time",
-	"Central Standard Time",
-	"Easter Island Standard Time",
-	"Galapagos Time",
-	"Mountain Standard Time",
-	"Clipperton Island Standard Time",
-	"Pacific Standard Time",
-	"Alaska Standard Time",
-	"Gambier Island Time",
-	"Marquesas Islands Time",
-	"Cook Island Time",
-	"Hawaii-Aleutian Standard Time",
-	"Hawaii Standard Time",
-	"Tahiti Time",
-	"Niue Time",
-	"Samoa Standard Time",
-	"Baker Island Time" };
-*/
+// names, abbreviations and shared suffixes, NUL-separated; a byte below 0x20 ends
+// a string with TZ_SUFFIX[byte - 1]
+const char TZ_POOL[] PROGMEM =
+	"South Georgia and the South Sandwich\012\0"	// 0
+	"Saint Pierre and Miquelon\002\0"	// 38
+	"Coordinated Universal\001\0"	// 65
+	"Fernando de Noronha\001\0"	// 88
+	"Heard and McDonald\004\0"	// 109
+	"Australian Western\002\0"	// 129
+	"Australian Central\002\0"	// 149
+	"Australian Eastern\002\0"	// 169
+	"Central Indonesia\001\0"	// 189
+	"Eastern Greenland\001\0"	// 208
+	"Eastern Caribbean\001\0"	// 227
+	"Dumont d'Urville\001\0"	// 246
+	"Papua New Guinea\001\0"	// 264
+	"Macquarie Island\005\0"	// 282
+	"Falkland Islands\002\0"	// 300
+	"Rothera Research\005\0"	// 318
+	"Further-eastern\006\0"	// 336
+	"Indian/Kerguelen\0"	// 353
+	"Sakhalin Island\011\0"	// 370
+	"Colombia Summer\001\0"	// 387
+	"Hawaii-Aleutian\002\0"	// 404
+	"British Indian\014\0"	// 421
+	"South African\002\0"	// 437
+	"Yekaterinburg\001\0"	// 452
+	"New Caledonia\001\0"	// 467
+	"Srednekolymsk\001\0"	// 482
+	"French Guiana\001\0"	// 497
+	"Turkmenistan\001\0"	// 512
+	"ASEAN Common\001\0"	// 526
+	"Newfoundland\001\0"	// 540
+	"Kaliningrad\001\0"	// 554
+	"Afghanistan\001\0"	// 567
+	"Krasnoyarsk\001\0"	// 580
+	"Ulaanbaatar\001\0"	// 593
+	"Timor Leste\001\0"	// 606
+	"Vladivostok\001\0"	// 619
+	"New Zealand\002\0"	// 632
+	" Indonesian\001\0"	// 645
+	"Azerbaijan\001\0"	// 658
+	"Seychelles\001\0"	// 670
+	"Tajikistan\001\0"	// 682
+	"Uzbekistan\001\0"	// 694
+	"Bangladesh\002\0"	// 706
+	"Kyrgyzstan\011\0"	// 718
+	"Philippine\002\0"	// 730
+	"Cape Verde\001\0"	// 742
+	"Venezuelan\002\0"	// 754
+	"Clipperton\013\0"	// 766
+	"Mauritius\001\0"	// 778
+	"Volgograd\001\0"	// 789
+	"Sri Lanka\001\0"	// 800
+	"Christmas\003\0"	// 811
+	"Indochina\001\0"	// 822
+	"Choibalsan\0"	// 833
+	"Hong Kong\001\0"	// 844
+	"Singapore\001\0"	// 855
+	"Lord Howe\002\0"	// 866
+	"Kamchatka\001\0"	// 877
+	"Argentina\001\0"	// 888
+	"Galapagos\001\0"	// 899
+	"Marquesas\004\0"	// 910
+	" Standard\001\0"	// 921
+	" European\001\0"	// 932
+	"R\303\251union\001\0"	// 943
+	"Maldives\001\0"	// 953
+	"Pakistan\002\0"	// 963
+	"Thailand\002\0"	// 973
+	"Malaysia\001\0"	// 983
+	"Chamorro\002\0"	// 993
+	"Marshall\012\0"	// 1003
+	"Brasilia\001\0"	// 1013
+	"Suriname\001\0"	// 1023
+	"Atlantic\002\0"	// 1033
+	"Falkland\004\0"	// 1043
+	"Paraguay\001\0"	// 1053
+	"Colombia\001\0"	// 1063
+	"Mountain\002\0"	// 1073
+	" Islands\001\0"	// 1083
+	" Station\001\0"	// 1093
+	"Western\006\0"	// 1103
+	"Central\006\0"	// 1112
+	"Central\007\0"	// 1121
+	"Eastern\006\0"	// 1130
+	"Armenia\001\0"	// 1139
+	"Georgia\002\0"	// 1148
+	"Myanmar\001\0"	// 1157
+	"Western\010\0"	// 1166
+	"Irkutsk\001\0"	// 1175
+	"Eastern\010\0"	// 1184
+	"Yakutsk\001\0"	// 1193
+	"Pohnpei\002\0"	// 1202
+	"Solomon\004\0"	// 1211
+	"Vanuatu\001\0"	// 1220
+	"Norfolk\001\0"	// 1229
+	"Gilbert\003\0"	// 1238
+	"Magadan\001\0"	// 1247
+	"Chatham\002\0"	// 1256
+	"Phoenix\003\0"	// 1265
+	"Tokelau\001\0"	// 1274
+	"Uruguay\002\0"	// 1283
+	"Bolivia\001\0"	// 1292
+	"Ecuador\001\0"	// 1301
+	"Pacific\002\0"	// 1310
+	"Gambier\003\0"	// 1319
+	" Island\001\0"	// 1328
+	" Africa\001\0"	// 1337
+	" Islands\0"	// 1346
+	" Island\002\0"	// 1355
+	"Israel\002\0"	// 1364
+	"Arabia\002\0"	// 1372
+	"Moscow\001\0"	// 1380
+	"Samara\001\0"	// 1388
+	"Mawson\005\0"	// 1396
+	"Indian\002\0"	// 1404
+	"Bhutan\001\0"	// 1412
+	"Vostok\005\0"	// 1420
+	"Brunei\001\0"	// 1428
+	"Kosrae\001\0"	// 1436
+	"Tuvalu\001\0"	// 1444
+	"Azores\002\0"	// 1452
+	"Amazon\001\0"	// 1460
+	"Guyana\001\0"	// 1468
+	"Easter\013\0"	// 1476
+	"Alaska\002\0"	// 1484
+	"Hawaii\002\0"	// 1492
+	"Tahiti\001\0"	// 1500
+	" Ocean\001\0"	// 1508
+	"Irish\002\0"	// 1516
+	"Showa\005\0"	// 1523
+	"Nepal\001\0"	// 1530
+	"Cocos\004\0"	// 1537
+	"Davis\001\0"	// 1544
+	"Khovd\001\0"	// 1551
+	"China\011\0"	// 1558
+	"Japan\002\0"	// 1565
+	"Korea\002\0"	// 1572
+	"Chuuk\001\0"	// 1579
+	"Tonga\001\0"	// 1586
+	"Chile\002\0"	// 1593
+	"Samoa\002\0"	// 1600
+	"Baker\003\0"	// 1607
+	"West\007\0"	// 1614
+	"East\007\0"	// 1620
+	"Iran\002\0"	// 1626
+	"Gulf\002\0"	// 1632
+	"Oral\001\0"	// 1638
+	"Omsk\001\0"	// 1644
+	"Fiji\001\0"	// 1650
+	"Wake\003\0"	// 1656
+	"Line\004\0"	// 1662
+	"Cuba\002\0"	// 1668
+	"Peru\001\0"	// 1674
+	"Cook\003\0"	// 1680
+	"Niue\001\0"	// 1686
+	"CHAST\0"	// 1692
+	"AZOST\0"	// 1698
+	" Time\0"	// 1704
+	" time\0"	// 1710
+	"IRLT\0"	// 1716
+	"SAST\0"	// 1721
+	"USZ1\0"	// 1726
+	"ARST\0"	// 1731
+	"SYOT\0"	// 1736
+	"IRST\0"	// 1741
+	"SAMT\0"	// 1746
+	"VOLT\0"	// 1751
+	"MAWT\0"	// 1756
+	"ORAT\0"	// 1761
+	"YEKT\0"	// 1766
+	"INST\0"	// 1771
+	"SLST\0"	// 1776
+	"BIOT\0"	// 1781
+	"OMST\0"	// 1786
+	"VOST\0"	// 1791
+	"DAVT\0"	// 1796
+	"HOVT\0"	// 1801
+	"KRAT\0"	// 1806
+	"AWST\0"	// 1811
+	"CHOT\0"	// 1816
+	"IRKT\0"	// 1821
+	"PHST\0"	// 1826
+	"ULAT\0"	// 1831
+	"YAKT\0"	// 1836
+	"ACST\0"	// 1841
+	"AEST\0"	// 1846
+	"ChST\0"	// 1851
+	"CHUT\0"	// 1856
+	"DDUT\0"	// 1861
+	"VLAT\0"	// 1866
+	"LHST\0"	// 1871
+	"KOST\0"	// 1876
+	"MIST\0"	// 1881
+	"PONT\0"	// 1886
+	"SAKT\0"	// 1891
+	"SRET\0"	// 1896
+	"GILT\0"	// 1901
+	"MAGT\0"	// 1906
+	"NZST\0"	// 1911
+	"PETT\0"	// 1916
+	"WAKT\0"	// 1921
+	"PHOT\0"	// 1926
+	"LINT\0"	// 1931
+	"SGST\0"	// 1936
+	"FKST\0"	// 1941
+	"PMST\0"	// 1946
+	"ROTT\0"	// 1951
+	"AMZT\0"	// 1956
+	"COST\0"	// 1961
+	"CUST\0"	// 1966
+	"ECUT\0"	// 1971
+	"EAST\0"	// 1976
+	"GALT\0"	// 1981
+	"CIST\0"	// 1986
+	"AKST\0"	// 1991
+	"MART\0"	// 1996
+	"TAHT\0"	// 2001
+	"UTC\0"	// 2006
+	"WET\0"	// 2010
+	"CET\0"	// 2014
+	"WAT\0"	// 2018
+	"CAT\0"	// 2022
+	"EET\0"	// 2026
+	"EAT\0"	// 2030
+	"FET\0"	// 2034
+	"MSK\0"	// 2038
+	"AZT\0"	// 2042
+	"GET\0"	// 2046
+	"MUT\0"	// 2050
+	"SCT\0"	// 2054
+	"AFT\0"	// 2058
+	"HMT\0"	// 2062
+	"MVT\0"	// 2066
+	"PKT\0"	// 2070
+	"TFT\0"	// 2074
+	"TJT\0"	// 2078
+	"TMT\0"	// 2082
+	"UZT\0"	// 2086
+	"NPT\0"	// 2090
+	"BST\0"	// 2094
+	"BTT\0"	// 2098
+	"KGT\0"	// 2102
+	"CCT\0"	// 2106
+	"MMT\0"	// 2110
+	"CXT\0"	// 2114
+	"ICT\0"	// 2118
+	"THA\0"	// 2122
+	"WIT\0"	// 2126
+	"ACT\0"	// 2130
+	"BDT\0"	// 2134
+	"CIT\0"	// 2138
+	"HKT\0"	// 2142
+	"MYT\0"	// 2146
+	"SGT\0"	// 2150
+	"EIT\0"	// 2154
+	"JST\0"	// 2158
+	"TLT\0"	// 2162
+	"PGT\0"	// 2166
+	"NCT\0"	// 2170
+	"SBT\0"	// 2174
+	"VUT\0"	// 2178
+	"NFT\0"	// 2182
+	"FJT\0"	// 2186
+	"MHT\0"	// 2190
+	"TVT\0"	// 2194
+	"TKT\0"	// 2198
+	"TOT\0"	// 2202
+	"CVT\0"	// 2206
+	"EGT\0"	// 2210
+	"FNT\0"	// 2214
+	"BRT\0"	// 2218
+	"GFT\0"	// 2222
+	"SRT\0"	// 2226
+	"UYT\0"	// 2230
+	"BOT\0"	// 2234
+	"CLT\0"	// 2238
+	"ECT\0"	// 2242
+	"FKT\0"	// 2246
+	"GYT\0"	// 2250
+	"PYT\0"	// 2254
+	"VET\0"	// 2258
+	"COT\0"	// 2262
+	"PET\0"	// 2266
+	"PST\0"	// 2270
+	"GIT\0"	// 2274
+	"CKT\0"	// 2278
+	"NUT\0"	// 2282
+	"SST\0"	// 2286
+	"BIT\0"	// 2290
+	;		// 2295 bytes
 
-const char* TZ_LOC[] = {
-	"UTC",
-	"WET",
-	"CET",
-	"IRLT",
-	"WAT",
-	"CAT",
-	"EET",
-	"IST",
-	"SAST",
-	"USZ1",
-	"ARST",
-	"EAT",
-	"FET",
-	"IOT",
-	"MSK",
-	"SYOT",
-	"IRST",
-	"AMT",
-	"AZT",
-	"GET",
-	"GST",
-	"MUT",
-	"RET",
-	"SAMT",
-	"SCT",
-	"VOLT",
-	"AFT",
-	"HMT",
-	"MAWT",
-	"MVT",
-	"ORAT",
-	"PKT",
-	"TFT",
-	"TJT",
-	"TMT",
-	"UZT",
-	"YEKT",
-	"INST",
-	"SLST",
-	"NPT",
-	"BIOT",
-	"BST",
-	"BTT",
-	"KGT",
-	"OMST",
-	"VOST",
-	"CCT",
-	"MMT",
-	"CXT",
-	"DAVT",
-	"HOVT",
-	"ICT",
-	"KRAT",
-	"THA",
-	"WIT",
-	"ACT",
-	"AWST",
-	"BDT",
-	"CHOT",
-	"CIT",
-	"CT",
-	"HKT",
-	"IRKT",
-	"MYT",
-	"PHST",
-	"SGT",
-	"ULAT",
-	"WST",
-	"EIT",
-	"JST",
-	"KST",
-	"TLT",
-	"YAKT",
-	"ACST",
-	"AEST",
-	"ChST",
-	"CHUT",
-	"DDUT",
-	"PGT",
-	"VLAT",
-	"LHST",
-	"KOST",
-	"MIST",
-	"NCT",
-	"PONT",
-	"SAKT",
-	"SBT",
-	"SRET",
-	"VUT",
-	"NFT",
-	"FJT",
-	"GILT",
-	"MAGT",
-	"MHT",
-	"NZST",
-	"PETT",
-	"TVT",
-	"WAKT",
-	"CHAST",
-	"PHOT",
-	"TKT",
-	"TOT",
-	"LINT",
-	"AZOST",
-	"CVT",
-	"EGT",
-	"FNT",
-	"SGST",
-	"ART",
-	"BRT",
-	"FKST",
-	"GFT",
-	"PMST",
-	"ROTT",
-	"SRT",
-	"UYT",
-	"NT",
-	"AMZT",
-	"AST",
-	"BOT",
-	"CLT",
-	"COST",
-	"ECT",
-	"FKT",
-	"GYT",
-	"PYT",
-	"VET",
-	"COT",
-	"CUST",
-	"ECUT",
-	"EST",
-	"PET",
-	"CST",
-	"EAST",
-	"GALT",
-	"MST",
-	"CIST",
-	"PST",
-	"AKST",
-	"GIT",
-	"MART",
-	"CKT",
-	"HAST",
-	"HST",
-	"TAHT",
-	"NUT",
-	"SST",
-	"BIT" };
+const unsigned int TZ_SUFFIX[] PROGMEM = {
+	1704,	// " Time"
+	921,	// " Standard\001"
+	1328,	// " Island\001"
+	1083,	// " Islands\001"
+	1093,	// " Station\001"
+	932,	// " European\001"
+	1337,	// " Africa\001"
+	645,	// " Indonesian\001"
+	1710,	// " time"
+	1346,	// " Islands"
+	1355,	// " Island\002"
+	1508 };	// " Ocean\001"
+
+const unsigned int TZ_NAME[] PROGMEM = {
+	65,	// UTC
+	1103,	// WET
+	1112,	// CET
+	1516,	// IRLT
+	1614,	// WAT
+	1121,	// CAT
+	1130,	// EET
+	1364,	// IST
+	437,	// SAST
+	554,	// USZ1
+	1372,	// ARST
+	1620,	// EAT
+	336,	// FET
+	429,	// IOT
+	1380,	// MSK
+	1523,	// SYOT
+	1626,	// IRST
+	1139,	// AMT
+	658,	// AZT
+	1148,	// GET
+	1632,	// GST
+	778,	// MUT
+	943,	// RET
+	1388,	// SAMT
+	670,	// SCT
+	789,	// VOLT
+	567,	// AFT
+	109,	// HMT
+	1396,	// MAWT
+	953,	// MVT
+	1638,	// ORAT
+	963,	// PKT
+	353,	// TFT
+	682,	// TJT
+	512,	// TMT
+	694,	// UZT
+	452,	// YEKT
+	1404,	// INST
+	800,	// SLST
+	1530,	// NPT
+	421,	// BIOT
+	706,	// BST
+	1412,	// BTT
+	718,	// KGT
+	1644,	// OMST
+	1420,	// VOST
+	1537,	// CCT
+	1157,	// MMT
+	811,	// CXT
+	1544,	// DAVT
+	1551,	// HOVT
+	822,	// ICT
+	580,	// KRAT
+	973,	// THA
+	1166,	// WIT
+	526,	// ACT
+	129,	// AWST
+	1428,	// BDT
+	833,	// CHOT
+	189,	// CIT
+	1558,	// CT
+	844,	// HKT
+	1175,	// IRKT
+	983,	// MYT
+	730,	// PHST
+	855,	// SGT
+	593,	// ULAT
+	140,	// WST
+	1184,	// EIT
+	1565,	// JST
+	1572,	// KST
+	606,	// TLT
+	1193,	// YAKT
+	149,	// ACST
+	169,	// AEST
+	993,	// ChST
+	1579,	// CHUT
+	246,	// DDUT
+	264,	// PGT
+	619,	// VLAT
+	866,	// LHST
+	1436,	// KOST
+	282,	// MIST
+	467,	// NCT
+	1202,	// PONT
+	370,	// SAKT
+	1211,	// SBT
+	482,	// SRET
+	1220,	// VUT
+	1229,	// NFT
+	1650,	// FJT
+	1238,	// GILT
+	1247,	// MAGT
+	1003,	// MHT
+	632,	// NZST
+	877,	// PETT
+	1444,	// TVT
+	1656,	// WAKT
+	1256,	// CHAST
+	1265,	// PHOT
+	1274,	// TKT
+	1586,	// TOT
+	1662,	// LINT
+	1452,	// AZOST
+	742,	// CVT
+	208,	// EGT
+	88,	// FNT
+	0,	// SGST
+	888,	// ART
+	1013,	// BRT
+	300,	// FKST
+	497,	// GFT
+	38,	// PMST
+	318,	// ROTT
+	1023,	// SRT
+	1283,	// UYT
+	540,	// NT
+	1460,	// AMZT
+	1033,	// AST
+	1292,	// BOT
+	1593,	// CLT
+	387,	// COST
+	227,	// ECT
+	1043,	// FKT
+	1468,	// GYT
+	1053,	// PYT
+	754,	// VET
+	1063,	// COT
+	1668,	// CUST
+	1301,	// ECUT
+	180,	// EST
+	1674,	// PET
+	160,	// CST
+	1476,	// EAST
+	899,	// GALT
+	1073,	// MST
+	766,	// CIST
+	1310,	// PST
+	1484,	// AKST
+	1319,	// GIT
+	910,	// MART
+	1680,	// CKT
+	404,	// HAST
+	1492,	// HST
+	1500,	// TAHT
+	1686,	// NUT
+	1600,	// SST
+	1607 };	// BIT
+
+const unsigned int TZ_LOC[] PROGMEM = {
+	2006,	// UTC
+	2010,	// WET
+	2014,	// CET
+	1716,	// IRLT
+	2018,	// WAT
+	2022,	// CAT
+	2026,	// EET
+	1882,	// IST
+	1721,	// SAST
+	1726,	// USZ1
+	1731,	// ARST
+	2030,	// EAT
+	2034,	// FET
+	1782,	// IOT
+	2038,	// MSK
+	1736,	// SYOT
+	1741,	// IRST
+	1747,	// AMT
+	2042,	// AZT
+	2046,	// GET
+	1937,	// GST
+	2050,	// MUT
+	1897,	// RET
+	1746,	// SAMT
+	2054,	// SCT
+	1751,	// VOLT
+	2058,	// AFT
+	2062,	// HMT
+	1756,	// MAWT
+	2066,	// MVT
+	1761,	// ORAT
+	2070,	// PKT
+	2074,	// TFT
+	2078,	// TJT
+	2082,	// TMT
+	2086,	// UZT
+	1766,	// YEKT
+	1771,	// INST
+	1776,	// SLST
+	2090,	// NPT
+	1781,	// BIOT
+	2094,	// BST
+	2098,	// BTT
+	2102,	// KGT
+	1786,	// OMST
+	1791,	// VOST
+	2106,	// CCT
+	2110,	// MMT
+	2114,	// CXT
+	1796,	// DAVT
+	1801,	// HOVT
+	2118,	// ICT
+	1806,	// KRAT
+	2122,	// THA
+	2126,	// WIT
+	2130,	// ACT
+	1811,	// AWST
+	2134,	// BDT
+	1816,	// CHOT
+	2138,	// CIT
+	2055,	// CT
+	2142,	// HKT
+	1821,	// IRKT
+	2146,	// MYT
+	1826,	// PHST
+	2150,	// SGT
+	1831,	// ULAT
+	1812,	// WST
+	2154,	// EIT
+	2158,	// JST
+	1942,	// KST
+	2162,	// TLT
+	1836,	// YAKT
+	1841,	// ACST
+	1846,	// AEST
+	1851,	// ChST
+	1856,	// CHUT
+	1861,	// DDUT
+	2166,	// PGT
+	1866,	// VLAT
+	1871,	// LHST
+	1876,	// KOST
+	1881,	// MIST
+	2170,	// NCT
+	1886,	// PONT
+	1891,	// SAKT
+	2174,	// SBT
+	1896,	// SRET
+	2178,	// VUT
+	2182,	// NFT
+	2186,	// FJT
+	1901,	// GILT
+	1906,	// MAGT
+	2190,	// MHT
+	1911,	// NZST
+	1916,	// PETT
+	2194,	// TVT
+	1921,	// WAKT
+	1692,	// CHAST
+	1926,	// PHOT
+	2198,	// TKT
+	2202,	// TOT
+	1931,	// LINT
+	1698,	// AZOST
+	2206,	// CVT
+	2210,	// EGT
+	2214,	// FNT
+	1936,	// SGST
+	1997,	// ART
+	2218,	// BRT
+	1941,	// FKST
+	2222,	// GFT
+	1946,	// PMST
+	1951,	// ROTT
+	2226,	// SRT
+	2230,	// UYT
+	1888,	// NT
+	1956,	// AMZT
+	1694,	// AST
+	2234,	// BOT
+	2238,	// CLT
+	1961,	// COST
+	2242,	// ECT
+	2246,	// FKT
+	2250,	// GYT
+	2254,	// PYT
+	2258,	// VET
+	2262,	// COT
+	1966,	// CUST
+	1971,	// ECUT
+	1847,	// EST
+	2266,	// PET
+	1842,	// CST
+	1976,	// EAST
+	1981,	// GALT
+	1787,	// MST
+	1986,	// CIST
+	2270,	// PST
+	1991,	// AKST
+	2274,	// GIT
+	1996,	// MART
+	2278,	// CKT
+	1693,	// HAST
+	1827,	// HST
+	2001,	// TAHT
+	2282,	// NUT
+	2286,	// SST
+	2290 };	// BIT
 
 const int TZ_HOUR[] PROGMEM = {
 	0,	// UTC
 	0,	// WET
 	1,	// CET
-	1,	// IRLT
+	0,	// IRLT
 	1,	// WAT
 	2,	// CAT
 	2,	// EET
@@ -502,7 +815,7 @@ const int TZ_HOUR[] PROGMEM = {
 	4,	// RET
 	4,	// SAMT
 	4,	// SCT
-	4,	// VOLT
+	3,	// VOLT
 	4,	// AFT
 	5,	// HMT
 	5,	// MAWT
@@ -522,7 +835,7 @@ const int TZ_HOUR[] PROGMEM = {
 	6,	// BTT
 	6,	// KGT
 	6,	// OMST
-	6,	// VOST
+	5,	// VOST
 	6,	// CCT
 	6,	// MMT
 	7,	// CXT
@@ -559,7 +872,7 @@ const int TZ_HOUR[] PROGMEM = {
 	10,	// VLAT
 	10,	// LHST
 	11,	// KOST
-	11,	// MIST
+	10,	// MIST
 	11,	// NCT
 	11,	// PONT
 	11,	// SAKT
@@ -569,7 +882,7 @@ const int TZ_HOUR[] PROGMEM = {
 	11,	// NFT
 	12,	// FJT
 	12,	// GILT
-	12,	// MAGT
+	11,	// MAGT
 	12,	// MHT
 	12,	// NZST
 	12,	// PETT
@@ -582,7 +895,7 @@ const int TZ_HOUR[] PROGMEM = {
 	14,	// LINT
 	-1,	// AZOST
 	-1,	// CVT
-	-1,	// EGT
+	-2,	// EGT
 	-2,	// FNT
 	-2,	// SGST
 	-3,	// ART
@@ -602,7 +915,7 @@ const int TZ_HOUR[] PROGMEM = {
 	-4,	// ECT
 	-4,	// FKT
 	-4,	// GYT
-	-4,	// PYT
+	-3,	// PYT
 	-4,	// VET
 	-5,	// COT
 	-5,	// CUST
@@ -716,7 +1029,7 @@ const int TZ_MIN[] PROGMEM = {
 	0,	// SBT
 	0,	// SRET
 	0,	// VUT
-	30,	// NFT
+	0,	// NFT
 	0,	// FJT
 	0,	// GILT
 	0,	// MAGT
@@ -753,7 +1066,7 @@ const int TZ_MIN[] PROGMEM = {
 	0,	// FKT
 	0,	// GYT
 	0,	// PYT
-	-30,	// VET
+	0,	// VET
 	0,	// COT
 	0,	// CUST
 	0,	// ECUT
@@ -776,36 +1089,40 @@ const int TZ_MIN[] PROGMEM = {
 	0,	// SST
 	0 };	// BIT
 
-#define DS_NONE 		0	//	never trigger DST
-#define DS_AFRICA		1	// 1st Sun of SEP, 1st Sun APR
-#define DS_AUSTRALIA	2	// 1st Sun of OCT, 1st Sun of APR
-#define DS_EUROPE		3	// last Sun of MAR (0th Sun of APR), last Sun of OCT (0th Sun of NOV)
-#define DS_FIJI		4	// 1st Sun of NOV, 3rd Sun of JAN
-#define DS_IRAN		5	// 22 MAR, 22 SEP
-#define DS_ISRAEL		6	// last Fri of MAR (0th Fri of APR), last Sun of OCT (0th Sun of NOV)
-#define DS_NAMERICA	7	// 2nd Sun of MAR, 1st Sun of NOV
-#define DS_NZEALAND	8	// last Sun of SEP (0th Sun of OCT), 1st Sun of APR
-#define DS_PARAGUAY	9	// 1st Sun of OCT, 4th Sun of MAR
-#define DS_URUGUAY	10	// 1st Sun of OCT, 2nd Sun of MAR
+#define DS_NONE		0	// never trigger DST
+#define DS_EUROPE_WET	1	// last Sun of MAR 01:00, last Sun of OCT 01:00
+#define DS_EUROPE_CET	2	// last Sun of MAR 02:00, last Sun of OCT 02:00
+#define DS_EUROPE_EET	3	// last Sun of MAR 03:00, last Sun of OCT 03:00
+#define DS_ISRAEL	4	// 4th Thu of MAR 26:00, last Sun of OCT 01:00
+#define DS_AUSTRALIA	5	// 1st Sun of OCT 02:00, 1st Sun of APR 02:00
+#define DS_NZEALAND	6	// last Sun of SEP 02:00, 1st Sun of APR 02:00
+#define DS_CHATHAM	7	// last Sun of SEP 02:45, 1st Sun of APR 02:45
+#define DS_AZORES	8	// last Sun of MAR 00:00, last Sun of OCT 00:00
+#define DS_GREENLAND	9	// last Sun of MAR -01:00, last Sun of OCT -01:00
+#define DS_NAMERICA	10	// 2nd Sun of MAR 02:00, 1st Sun of NOV 01:00
+#define DS_CHILE	11	// 1st Sat of SEP 24:00, 1st Sat of APR 23:00
+#define DS_CUBA	12	// 2nd Sun of MAR 00:00, 1st Sun of NOV 00:00
+#define DS_EASTER	13	// 1st Sat of SEP 22:00, 1st Sat of APR 21:00
+#define SZ_DS		14	// total number of DST rulesets
 
 const byte TZ_DST[] PROGMEM = {
 	DS_NONE,	// UTC
-	DS_EUROPE,	// WET
-	DS_EUROPE,	// CET
-	DS_NONE,	// IRLT
-	DS_AFRICA,	// WAT
+	DS_EUROPE_WET,	// WET
+	DS_EUROPE_CET,	// CET
+	DS_EUROPE_WET,	// IRLT
+	DS_NONE,	// WAT
 	DS_NONE,	// CAT
-	DS_EUROPE,	// EET
+	DS_EUROPE_EET,	// EET
 	DS_ISRAEL,	// IST
 	DS_NONE,	// SAST
 	DS_NONE,	// USZ1
 	DS_NONE,	// ARST
 	DS_NONE,	// EAT
-	DS_EUROPE,	// FET
+	DS_NONE,	// FET
 	DS_NONE,	// IOT
 	DS_NONE,	// MSK
 	DS_NONE,	// SYOT
-	DS_IRAN,	// IRST
+	DS_NONE,	// IRST
 	DS_NONE,	// AMT
 	DS_NONE,	// AZT
 	DS_NONE,	// GET
@@ -869,17 +1186,17 @@ const byte TZ_DST[] PROGMEM = {
 	DS_NONE,	// DDUT
 	DS_NONE,	// PGT
 	DS_NONE,	// VLAT
-	DS_NONE,	// LHST
+	DS_NONE,	// LHST (DST is not one hour)
 	DS_NONE,	// KOST
-	DS_NONE,	// MIST
+	DS_AUSTRALIA,	// MIST
 	DS_NONE,	// NCT
 	DS_NONE,	// PONT
 	DS_NONE,	// SAKT
 	DS_NONE,	// SBT
 	DS_NONE,	// SRET
 	DS_NONE,	// VUT
-	DS_NONE,	// NFT
-	DS_FIJI,	// FJT
+	DS_AUSTRALIA,	// NFT
+	DS_NONE,	// FJT
 	DS_NONE,	// GILT
 	DS_NONE,	// MAGT
 	DS_NONE,	// MHT
@@ -887,14 +1204,14 @@ const byte TZ_DST[] PROGMEM = {
 	DS_NONE,	// PETT
 	DS_NONE,	// TVT
 	DS_NONE,	// WAKT
-	DS_NZEALAND,	// CHAST
+	DS_CHATHAM,	// CHAST
 	DS_NONE,	// PHOT
 	DS_NONE,	// TKT
 	DS_NONE,	// TOT
 	DS_NONE,	// LINT
-	DS_NONE,	// AZOST
+	DS_AZORES,	// AZOST
 	DS_NONE,	// CVT
-	DS_EUROPE,	// EGT
+	DS_GREENLAND,	// EGT
 	DS_NONE,	// FNT
 	DS_NONE,	// SGST
 	DS_NONE,	// ART
@@ -904,25 +1221,25 @@ const byte TZ_DST[] PROGMEM = {
 	DS_NAMERICA,	// PMST
 	DS_NONE,	// ROTT
 	DS_NONE,	// SRT
-	DS_URUGUAY,	// UYT
-	DS_NONE,	// NT
+	DS_NONE,	// UYT
+	DS_NAMERICA,	// NT
 	DS_NONE,	// AMZT
 	DS_NONE,	// AST
 	DS_NONE,	// BOT
-	DS_NONE,	// CLT
+	DS_CHILE,	// CLT
 	DS_NONE,	// COST
 	DS_NONE,	// ECT
 	DS_NONE,	// FKT
 	DS_NONE,	// GYT
-	DS_PARAGUAY,	// PYT
+	DS_NONE,	// PYT
 	DS_NONE,	// VET
 	DS_NONE,	// COT
-	DS_NAMERICA,	// CUST
+	DS_CUBA,	// CUST
 	DS_NONE,	// ECUT
 	DS_NAMERICA,	// EST
 	DS_NONE,	// PET
 	DS_NAMERICA,	// CST
-	DS_NONE,	// EAST
+	DS_EASTER,	// EAST
 	DS_NONE,	// GALT
 	DS_NAMERICA,	// MST
 	DS_NONE,	// CIST
@@ -938,109 +1255,1554 @@ const byte TZ_DST[] PROGMEM = {
 	DS_NONE,	// SST
 	DS_NONE };	// BIT
 
+// each zone's UTC transitions from the epoch until its current rules took over (see
+// stepZone() for the encoding); the last record of a zone is where the rules take
+// over, and a zone with no records has followed them since the epoch
+const byte TZ_TRANS[] PROGMEM = {
+	0x00, 0x08,                   // IST 2000-01-01 00:00Z +02:00
+	0x80, 0x92, 0x09, 0x8c,       //     2000-04-14 00:00Z +03:00 DST
+	0xe8, 0xaf, 0x0f, 0x08,       //     2000-10-05 22:00Z +02:00
+	0xdc, 0xa1, 0x10, 0x8c,       //     2001-04-08 23:00Z +03:00 DST
+	0xc4, 0xe1, 0x0e, 0x08,       //     2001-09-23 22:00Z +02:00
+	0xfc, 0xac, 0x10, 0x8c,       //     2002-03-28 23:00Z +03:00 DST
+	0xc4, 0xef, 0x10, 0x08,       //     2002-10-06 22:00Z +02:00
+	0xbc, 0x8f, 0x0f, 0x8c,       //     2003-03-27 23:00Z +03:00 DST
+	0xe4, 0xcd, 0x10, 0x08,       //     2003-10-02 22:00Z +02:00
+	0x9c, 0xb8, 0x10, 0x8c,       //     2004-04-06 23:00Z +03:00 DST
+	0xc4, 0xe1, 0x0e, 0x08,       //     2004-09-21 22:00Z +02:00
+	0xd8, 0xe5, 0x10, 0x8c,       //     2005-04-01 00:00Z +03:00 DST
+	0xa4, 0xe4, 0x10, 0x08,       //     2005-10-08 23:00Z +02:00
+	0xdc, 0x9a, 0x0f, 0x8c,       //     2006-03-31 00:00Z +03:00 DST
+	0xc4, 0x95, 0x10, 0x08,       //     2006-09-30 23:00Z +02:00
+	0xbc, 0xe9, 0x0f, 0x8c,       //     2007-03-30 00:00Z +03:00 DST
+	0x84, 0xf8, 0x0e, 0x08,       //     2007-09-15 23:00Z +02:00
+	0xfc, 0x86, 0x11, 0x8c,       //     2008-03-28 00:00Z +03:00 DST
+	0xa4, 0xe4, 0x10, 0x08,       //     2008-10-04 23:00Z +02:00
+	0xdc, 0x9a, 0x0f, 0x8c,       //     2009-03-27 00:00Z +03:00 DST
+	0xc4, 0x95, 0x10, 0x08,       //     2009-09-26 23:00Z +02:00
+	0xbc, 0xe9, 0x0f, 0x8c,       //     2010-03-26 00:00Z +03:00 DST
+	0x84, 0xf8, 0x0e, 0x08,       //     2010-09-11 23:00Z +02:00
+	0xdc, 0xd5, 0x11, 0x8c,       //     2011-04-01 00:00Z +03:00 DST
+	0xc4, 0x95, 0x10, 0x08,       //     2011-10-01 23:00Z +02:00
+	0xbc, 0xe9, 0x0f, 0x8c,       //     2012-03-30 00:00Z +03:00 DST
+	0xe4, 0xc6, 0x0f, 0x08,       //     2012-09-22 23:00Z +02:00
+	0x9c, 0xb8, 0x10, 0x8c,       //     2013-03-29 00:00Z +03:00 rules
+	0x00, 0x08,                   // USZ1 2000-01-01 00:00Z +02:00
+	0xa0, 0xbc, 0x07, 0x8c,       //     2000-03-26 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2000-10-29 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x8c,       //     2001-03-25 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2001-10-28 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2002-03-31 00:00Z +03:00 DST
+	0xc0, 0xba, 0x12, 0x08,       //     2002-10-27 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2003-03-30 00:00Z +03:00 DST
+	0xc0, 0xba, 0x12, 0x08,       //     2003-10-26 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2004-03-28 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2004-10-31 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x8c,       //     2005-03-27 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2005-10-30 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x8c,       //     2006-03-26 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2006-10-29 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x8c,       //     2007-03-25 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2007-10-28 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2008-03-30 00:00Z +03:00 DST
+	0xc0, 0xba, 0x12, 0x08,       //     2008-10-26 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2009-03-29 00:00Z +03:00 DST
+	0xc0, 0xba, 0x12, 0x08,       //     2009-10-25 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2010-03-28 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2010-10-31 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x0c,       //     2011-03-27 00:00Z +03:00
+	0xe4, 0x85, 0x73, 0x08,       //     2014-10-25 23:00Z +02:00 rules
+	0x00, 0x08,                   // FET 2000-01-01 00:00Z +02:00
+	0xa0, 0xbc, 0x07, 0x8c,       //     2000-03-26 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2000-10-29 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x8c,       //     2001-03-25 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2001-10-28 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2002-03-31 00:00Z +03:00 DST
+	0xc0, 0xba, 0x12, 0x08,       //     2002-10-27 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2003-03-30 00:00Z +03:00 DST
+	0xc0, 0xba, 0x12, 0x08,       //     2003-10-26 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2004-03-28 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2004-10-31 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x8c,       //     2005-03-27 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2005-10-30 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x8c,       //     2006-03-26 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2006-10-29 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x8c,       //     2007-03-25 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2007-10-28 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2008-03-30 00:00Z +03:00 DST
+	0xc0, 0xba, 0x12, 0x08,       //     2008-10-26 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2009-03-29 00:00Z +03:00 DST
+	0xc0, 0xba, 0x12, 0x08,       //     2009-10-25 00:00Z +02:00
+	0xc0, 0xc4, 0x0d, 0x8c,       //     2010-03-28 00:00Z +03:00 DST
+	0xa0, 0x89, 0x13, 0x08,       //     2010-10-31 00:00Z +02:00
+	0xe0, 0xf5, 0x0c, 0x0c,       //     2011-03-27 00:00Z +03:00 rules
+	0x00, 0x0c,                   // MSK 2000-01-01 00:00Z +03:00
+	0xe4, 0xbb, 0x07, 0x90,       //     2000-03-25 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2000-10-28 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x90,       //     2001-03-24 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2001-10-27 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2002-03-30 23:00Z +04:00 DST
+	0xc0, 0xba, 0x12, 0x0c,       //     2002-10-26 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2003-03-29 23:00Z +04:00 DST
+	0xc0, 0xba, 0x12, 0x0c,       //     2003-10-25 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2004-03-27 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2004-10-30 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x90,       //     2005-03-26 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2005-10-29 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x90,       //     2006-03-25 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2006-10-28 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x90,       //     2007-03-24 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2007-10-27 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2008-03-29 23:00Z +04:00 DST
+	0xc0, 0xba, 0x12, 0x0c,       //     2008-10-25 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2009-03-28 23:00Z +04:00 DST
+	0xc0, 0xba, 0x12, 0x0c,       //     2009-10-24 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2010-03-27 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2010-10-30 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x10,       //     2011-03-26 23:00Z +04:00
+	0xe4, 0x85, 0x73, 0x0c,       //     2014-10-25 22:00Z +03:00 rules
+	0x00, 0x0e,                   // IRST 2000-01-01 00:00Z +03:30
+	0xae, 0x82, 0x07, 0x92,       //     2000-03-20 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2000-09-20 19:30Z +03:30
+	0xfc, 0xff, 0x0f, 0x92,       //     2001-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2001-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2002-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2002-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2003-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2003-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2004-03-20 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2004-09-20 19:30Z +03:30
+	0xfc, 0xff, 0x0f, 0x92,       //     2005-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2005-09-21 19:30Z +03:30
+	0x9c, 0x89, 0x50, 0x92,       //     2008-03-20 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2008-09-20 19:30Z +03:30
+	0xfc, 0xff, 0x0f, 0x92,       //     2009-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2009-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2010-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2010-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2011-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2011-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2012-03-20 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2012-09-20 19:30Z +03:30
+	0xfc, 0xff, 0x0f, 0x92,       //     2013-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2013-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2014-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2014-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2015-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2015-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2016-03-20 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2016-09-20 19:30Z +03:30
+	0xfc, 0xff, 0x0f, 0x92,       //     2017-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2017-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2018-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2018-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2019-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2019-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2020-03-20 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2020-09-20 19:30Z +03:30
+	0xfc, 0xff, 0x0f, 0x92,       //     2021-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2021-09-21 19:30Z +03:30
+	0xdc, 0xf4, 0x0f, 0x92,       //     2022-03-21 20:30Z +04:30 DST
+	0xc4, 0x95, 0x10, 0x0e,       //     2022-09-21 19:30Z +03:30 rules
+	0x00, 0x10,                   // AMT 2000-01-01 00:00Z +04:00
+	0xa8, 0xbb, 0x07, 0x94,       //     2000-03-25 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2000-10-28 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2001-03-24 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2001-10-27 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2002-03-30 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2002-10-26 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2003-03-29 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2003-10-25 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2004-03-27 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2004-10-30 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2005-03-26 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2005-10-29 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2006-03-25 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2006-10-28 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2007-03-24 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2007-10-27 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2008-03-29 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2008-10-25 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2009-03-28 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2009-10-24 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2010-03-27 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2010-10-30 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2011-03-26 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2011-10-29 22:00Z +04:00 rules
+	0x00, 0x10,                   // AZT 2000-01-01 00:00Z +04:00
+	0xa0, 0xbc, 0x07, 0x94,       //     2000-03-26 00:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2000-10-29 00:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2001-03-25 00:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2001-10-28 00:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2002-03-31 00:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2002-10-27 00:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2003-03-30 00:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2003-10-26 00:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2004-03-28 00:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2004-10-31 00:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2005-03-27 00:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2005-10-30 00:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2006-03-26 00:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2006-10-29 00:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2007-03-25 00:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2007-10-28 00:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2008-03-30 00:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2008-10-26 00:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2009-03-29 00:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2009-10-25 00:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2010-03-28 00:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2010-10-31 00:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2011-03-27 00:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2011-10-30 00:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2012-03-25 00:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2012-10-28 00:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2013-03-31 00:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2013-10-27 00:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2014-03-30 00:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2014-10-26 00:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2015-03-29 00:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2015-10-25 00:00Z +04:00 rules
+	0x00, 0x10,                   // GET 2000-01-01 00:00Z +04:00
+	0xb0, 0xba, 0x07, 0x94,       //     2000-03-25 20:00Z +05:00 DST
+	0xe4, 0x88, 0x13, 0x10,       //     2000-10-28 19:00Z +04:00
+	0x9c, 0xf6, 0x0c, 0x94,       //     2001-03-24 20:00Z +05:00 DST
+	0xe4, 0x88, 0x13, 0x10,       //     2001-10-27 19:00Z +04:00
+	0xfc, 0xc4, 0x0d, 0x94,       //     2002-03-30 20:00Z +05:00 DST
+	0x84, 0xba, 0x12, 0x10,       //     2002-10-26 19:00Z +04:00
+	0xfc, 0xc4, 0x0d, 0x94,       //     2003-03-29 20:00Z +05:00 DST
+	0x84, 0xba, 0x12, 0x10,       //     2003-10-25 19:00Z +04:00
+	0xfc, 0xc4, 0x0d, 0x94,       //     2004-03-27 20:00Z +05:00 DST
+	0xa4, 0xff, 0x07, 0x90,       //     2004-06-26 19:00Z +04:00 DST
+	0xb0, 0x8b, 0x0b, 0x0c,       //     2004-10-30 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x10,       //     2005-03-26 23:00Z +04:00 rules
+	0x00, 0x10,                   // MUT 2000-01-01 00:00Z +04:00
+	0xa8, 0x8b, 0x9b, 0x02, 0x94, //     2008-10-25 22:00Z +05:00 DST
+	0x84, 0xc4, 0x0d, 0x10,       //     2009-03-28 21:00Z +04:00 rules
+	0x00, 0x10,                   // SAMT 2000-01-01 00:00Z +04:00
+	0xa8, 0xbb, 0x07, 0x94,       //     2000-03-25 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2000-10-28 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2001-03-24 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2001-10-27 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2002-03-30 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2002-10-26 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2003-03-29 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2003-10-25 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2004-03-27 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2004-10-30 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2005-03-26 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2005-10-29 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2006-03-25 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2006-10-28 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2007-03-24 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2007-10-27 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2008-03-29 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2008-10-25 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2009-03-28 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2009-10-24 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2010-03-27 22:00Z +04:00 DST
+	0xdc, 0x89, 0x13, 0x0c,       //     2010-10-30 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x10,       //     2011-03-26 23:00Z +04:00 rules
+	0x00, 0x0c,                   // VOLT 2000-01-01 00:00Z +03:00
+	0xe4, 0xbb, 0x07, 0x90,       //     2000-03-25 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2000-10-28 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x90,       //     2001-03-24 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2001-10-27 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2002-03-30 23:00Z +04:00 DST
+	0xc0, 0xba, 0x12, 0x0c,       //     2002-10-26 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2003-03-29 23:00Z +04:00 DST
+	0xc0, 0xba, 0x12, 0x0c,       //     2003-10-25 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2004-03-27 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2004-10-30 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x90,       //     2005-03-26 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2005-10-29 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x90,       //     2006-03-25 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2006-10-28 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x90,       //     2007-03-24 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2007-10-27 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2008-03-29 23:00Z +04:00 DST
+	0xc0, 0xba, 0x12, 0x0c,       //     2008-10-25 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2009-03-28 23:00Z +04:00 DST
+	0xc0, 0xba, 0x12, 0x0c,       //     2009-10-24 23:00Z +03:00
+	0xc0, 0xc4, 0x0d, 0x90,       //     2010-03-27 23:00Z +04:00 DST
+	0xa0, 0x89, 0x13, 0x0c,       //     2010-10-30 23:00Z +03:00
+	0xe0, 0xf5, 0x0c, 0x10,       //     2011-03-26 23:00Z +04:00
+	0xe4, 0x85, 0x73, 0x0c,       //     2014-10-25 22:00Z +03:00
+	0x9c, 0xcb, 0x80, 0x01, 0x10, //     2018-10-27 23:00Z +04:00
+	0xa4, 0xc2, 0x45, 0x0c,       //     2020-12-26 22:00Z +03:00 rules
+	0x00, 0x18,                   // MAWT 2000-01-01 00:00Z +06:00
+	0xd0, 0xba, 0xba, 0x02, 0x14, //     2009-10-17 20:00Z +05:00 rules
+	0x00, 0x10,                   // ORAT 2000-01-01 00:00Z +04:00
+	0xa8, 0xbb, 0x07, 0x94,       //     2000-03-25 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2000-10-28 22:00Z +04:00
+	0xe0, 0xf5, 0x0c, 0x94,       //     2001-03-24 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x10,       //     2001-10-27 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2002-03-30 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2002-10-26 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2003-03-29 22:00Z +05:00 DST
+	0xc0, 0xba, 0x12, 0x10,       //     2003-10-25 22:00Z +04:00
+	0xc0, 0xc4, 0x0d, 0x94,       //     2004-03-27 22:00Z +05:00 DST
+	0xa0, 0x89, 0x13, 0x14,       //     2004-10-30 22:00Z +05:00 rules
+	0x00, 0x14,                   // PKT 2000-01-01 00:00Z +05:00
+	0xb4, 0xd5, 0x48, 0x98,       //     2002-04-06 19:00Z +06:00 DST
+	0x84, 0xff, 0x0f, 0x14,       //     2002-10-05 18:00Z +05:00
+	0xdc, 0xbf, 0xb5, 0x01, 0x98, //     2008-05-31 19:00Z +06:00 DST
+	0xe4, 0xb8, 0x0d, 0x14,       //     2008-10-31 18:00Z +05:00
+	0xdc, 0xc0, 0x0e, 0x98,       //     2009-04-14 19:00Z +06:00 DST
+	0xc4, 0xc9, 0x11, 0x14,       //     2009-10-31 18:00Z +05:00 rules
+	0x00, 0x14,                   // YEKT 2000-01-01 00:00Z +05:00
+	0xec, 0xba, 0x07, 0x98,       //     2000-03-25 21:00Z +06:00 DST
+	0xa0, 0x89, 0x13, 0x14,       //     2000-10-28 21:00Z +05:00
+	0xe0, 0xf5, 0x0c, 0x98,       //     2001-03-24 21:00Z +06:00 DST
+	0xa0, 0x89, 0x13, 0x14,       //     2001-10-27 21:00Z +05:00
+	0xc0, 0xc4, 0x0d, 0x98,       //     2002-03-30 21:00Z +06:00 DST
+	0xc0, 0xba, 0x12, 0x14,       //     2002-10-26 21:00Z +05:00
+	0xc0, 0xc4, 0x0d, 0x98,       //     2003-03-29 21:00Z +06:00 DST
+	0xc0, 0xba, 0x12, 0x14,       //     2003-10-25 21:00Z +05:00
+	0xc0, 0xc4, 0x0d, 0x98,       //     2004-03-27 21:00Z +06:00 DST
+	0xa0, 0x89, 0x13, 0x14,       //     2004-10-30 21:00Z +05:00
+	0xe0, 0xf5, 0x0c, 0x98,       //     2005-03-26 21:00Z +06:00 DST
+	0xa0, 0x89, 0x13, 0x14,       //     2005-10-29 21:00Z +05:00
+	0xe0, 0xf5, 0x0c, 0x98,       //     2006-03-25 21:00Z +06:00 DST
+	0xa0, 0x89, 0x13, 0x14,       //     2006-10-28 21:00Z +05:00
+	0xe0, 0xf5, 0x0c, 0x98,       //     2007-03-24 21:00Z +06:00 DST
+	0xa0, 0x89, 0x13, 0x14,       //     2007-10-27 21:00Z +05:00
+	0xc0, 0xc4, 0x0d, 0x98,       //     2008-03-29 21:00Z +06:00 DST
+	0xc0, 0xba, 0x12, 0x14,       //     2008-10-25 21:00Z +05:00
+	0xc0, 0xc4, 0x0d, 0x98,       //     2009-03-28 21:00Z +06:00 DST
+	0xc0, 0xba, 0x12, 0x14,       //     2009-10-24 21:00Z +05:00
+	0xc0, 0xc4, 0x0d, 0x98,       //     2010-03-27 21:00Z +06:00 DST
+	0xa0, 0x89, 0x13, 0x14,       //     2010-10-30 21:00Z +05:00
+	0xe0, 0xf5, 0x0c, 0x18,       //     2011-03-26 21:00Z +06:00
+	0xe4, 0x85, 0x73, 0x14,       //     2014-10-25 20:00Z +05:00 rules
+	0x00, 0x18,                   // SLST 2000-01-01 00:00Z +06:00
+	0xb6, 0xe3, 0xc9, 0x01, 0x16, //     2006-04-14 18:30Z +05:30 rules
+	0x00, 0x18,                   // BST 2000-01-01 00:00Z +06:00
+	0x9c, 0xf3, 0xaf, 0x02, 0x9c, //     2009-06-19 17:00Z +07:00 DST
+	0xe0, 0x91, 0x11, 0x18,       //     2009-12-31 17:00Z +06:00 rules
+	0x00, 0x14,                   // KGT 2000-01-01 00:00Z +05:00
+	0x8a, 0xbb, 0x07, 0x98,       //     2000-03-25 21:30Z +06:00 DST
+	0xe4, 0x88, 0x13, 0x14,       //     2000-10-28 20:30Z +05:00
+	0x9c, 0xf6, 0x0c, 0x98,       //     2001-03-24 21:30Z +06:00 DST
+	0xe4, 0x88, 0x13, 0x14,       //     2001-10-27 20:30Z +05:00
+	0xfc, 0xc4, 0x0d, 0x98,       //     2002-03-30 21:30Z +06:00 DST
+	0x84, 0xba, 0x12, 0x14,       //     2002-10-26 20:30Z +05:00
+	0xfc, 0xc4, 0x0d, 0x98,       //     2003-03-29 21:30Z +06:00 DST
+	0x84, 0xba, 0x12, 0x14,       //     2003-10-25 20:30Z +05:00
+	0xfc, 0xc4, 0x0d, 0x98,       //     2004-03-27 21:30Z +06:00 DST
+	0xe4, 0x88, 0x13, 0x14,       //     2004-10-30 20:30Z +05:00
+	0x9c, 0xf6, 0x0c, 0x98,       //     2005-03-26 21:30Z +06:00 DST
+	0xee, 0x8e, 0x0c, 0x18,       //     2005-08-11 18:00Z +06:00 rules
+	0x00, 0x18,                   // OMST 2000-01-01 00:00Z +06:00
+	0xb0, 0xba, 0x07, 0x9c,       //     2000-03-25 20:00Z +07:00 DST
+	0xa0, 0x89, 0x13, 0x18,       //     2000-10-28 20:00Z +06:00
+	0xe0, 0xf5, 0x0c, 0x9c,       //     2001-03-24 20:00Z +07:00 DST
+	0xa0, 0x89, 0x13, 0x18,       //     2001-10-27 20:00Z +06:00
+	0xc0, 0xc4, 0x0d, 0x9c,       //     2002-03-30 20:00Z +07:00 DST
+	0xc0, 0xba, 0x12, 0x18,       //     2002-10-26 20:00Z +06:00
+	0xc0, 0xc4, 0x0d, 0x9c,       //     2003-03-29 20:00Z +07:00 DST
+	0xc0, 0xba, 0x12, 0x18,       //     2003-10-25 20:00Z +06:00
+	0xc0, 0xc4, 0x0d, 0x9c,       //     2004-03-27 20:00Z +07:00 DST
+	0xa0, 0x89, 0x13, 0x18,       //     2004-10-30 20:00Z +06:00
+	0xe0, 0xf5, 0x0c, 0x9c,       //     2005-03-26 20:00Z +07:00 DST
+	0xa0, 0x89, 0x13, 0x18,       //     2005-10-29 20:00Z +06:00
+	0xe0, 0xf5, 0x0c, 0x9c,       //     2006-03-25 20:00Z +07:00 DST
+	0xa0, 0x89, 0x13, 0x18,       //     2006-10-28 20:00Z +06:00
+	0xe0, 0xf5, 0x0c, 0x9c,       //     2007-03-24 20:00Z +07:00 DST
+	0xa0, 0x89, 0x13, 0x18,       //     2007-10-27 20:00Z +06:00
+	0xc0, 0xc4, 0x0d, 0x9c,       //     2008-03-29 20:00Z +07:00 DST
+	0xc0, 0xba, 0x12, 0x18,       //     2008-10-25 20:00Z +06:00
+	0xc0, 0xc4, 0x0d, 0x9c,       //     2009-03-28 20:00Z +07:00 DST
+	0xc0, 0xba, 0x12, 0x18,       //     2009-10-24 20:00Z +06:00
+	0xc0, 0xc4, 0x0d, 0x9c,       //     2010-03-27 20:00Z +07:00 DST
+	0xa0, 0x89, 0x13, 0x18,       //     2010-10-30 20:00Z +06:00
+	0xe0, 0xf5, 0x0c, 0x1c,       //     2011-03-26 20:00Z +07:00
+	0xe4, 0x85, 0x73, 0x18,       //     2014-10-25 19:00Z +06:00 rules
+	0x00, 0x1c,                   // VOST 2000-01-01 00:00Z +07:00
+	0xd4, 0x99, 0x81, 0x06, 0x14, //     2023-12-17 19:00Z +05:00 rules
+	0x00, 0x1c,                   // DAVT 2000-01-01 00:00Z +07:00
+	0x94, 0xba, 0xba, 0x02, 0x14, //     2009-10-17 19:00Z +05:00
+	0xbc, 0xd4, 0x0c, 0x1c,       //     2010-03-10 20:00Z +07:00
+	0xc4, 0xb0, 0x34, 0x14,       //     2011-10-27 19:00Z +05:00
+	0xdc, 0xa4, 0x0a, 0x1c,       //     2012-02-21 20:00Z +07:00 rules
+	0x00, 0x1c,                   // HOVT 2000-01-01 00:00Z +07:00
+	0xb4, 0xb7, 0x2a, 0xa0,       //     2001-04-27 19:00Z +08:00 DST
+	0x84, 0xc4, 0x0d, 0x1c,       //     2001-09-28 18:00Z +07:00
+	0xfc, 0xff, 0x0f, 0xa0,       //     2002-03-29 19:00Z +08:00 DST
+	0x84, 0xff, 0x0f, 0x1c,       //     2002-09-27 18:00Z +07:00
+	0xfc, 0xff, 0x0f, 0xa0,       //     2003-03-28 19:00Z +08:00 DST
+	0x84, 0xff, 0x0f, 0x1c,       //     2003-09-26 18:00Z +07:00
+	0xfc, 0xff, 0x0f, 0xa0,       //     2004-03-26 19:00Z +08:00 DST
+	0x84, 0xff, 0x0f, 0x1c,       //     2004-09-24 18:00Z +07:00
+	0xfc, 0xff, 0x0f, 0xa0,       //     2005-03-25 19:00Z +08:00 DST
+	0x84, 0xff, 0x0f, 0x1c,       //     2005-09-23 18:00Z +07:00
+	0xfc, 0xff, 0x0f, 0xa0,       //     2006-03-24 19:00Z +08:00 DST
+	0xe4, 0xcd, 0x10, 0x1c,       //     2006-09-29 18:00Z +07:00
+	0xdc, 0xc6, 0x90, 0x02, 0xa0, //     2015-03-27 19:00Z +08:00 DST
+	0x8c, 0xfe, 0x0f, 0x1c,       //     2015-09-25 16:00Z +07:00
+	0xf4, 0x80, 0x10, 0xa0,       //     2016-03-25 19:00Z +08:00 DST
+	0x8c, 0xfe, 0x0f, 0x1c,       //     2016-09-23 16:00Z +07:00 rules
+	0x00, 0x1c,                   // KRAT 2000-01-01 00:00Z +07:00
+	0xf4, 0xb9, 0x07, 0xa0,       //     2000-03-25 19:00Z +08:00 DST
+	0xa0, 0x89, 0x13, 0x1c,       //     2000-10-28 19:00Z +07:00
+	0xe0, 0xf5, 0x0c, 0xa0,       //     2001-03-24 19:00Z +08:00 DST
+	0xa0, 0x89, 0x13, 0x1c,       //     2001-10-27 19:00Z +07:00
+	0xc0, 0xc4, 0x0d, 0xa0,       //     2002-03-30 19:00Z +08:00 DST
+	0xc0, 0xba, 0x12, 0x1c,       //     2002-10-26 19:00Z +07:00
+	0xc0, 0xc4, 0x0d, 0xa0,       //     2003-03-29 19:00Z +08:00 DST
+	0xc0, 0xba, 0x12, 0x1c,       //     2003-10-25 19:00Z +07:00
+	0xc0, 0xc4, 0x0d, 0xa0,       //     2004-03-27 19:00Z +08:00 DST
+	0xa0, 0x89, 0x13, 0x1c,       //     2004-10-30 19:00Z +07:00
+	0xe0, 0xf5, 0x0c, 0xa0,       //     2005-03-26 19:00Z +08:00 DST
+	0xa0, 0x89, 0x13, 0x1c,       //     2005-10-29 19:00Z +07:00
+	0xe0, 0xf5, 0x0c, 0xa0,       //     2006-03-25 19:00Z +08:00 DST
+	0xa0, 0x89, 0x13, 0x1c,       //     2006-10-28 19:00Z +07:00
+	0xe0, 0xf5, 0x0c, 0xa0,       //     2007-03-24 19:00Z +08:00 DST
+	0xa0, 0x89, 0x13, 0x1c,       //     2007-10-27 19:00Z +07:00
+	0xc0, 0xc4, 0x0d, 0xa0,       //     2008-03-29 19:00Z +08:00 DST
+	0xc0, 0xba, 0x12, 0x1c,       //     2008-10-25 19:00Z +07:00
+	0xc0, 0xc4, 0x0d, 0xa0,       //     2009-03-28 19:00Z +08:00 DST
+	0xc0, 0xba, 0x12, 0x1c,       //     2009-10-24 19:00Z +07:00
+	0xc0, 0xc4, 0x0d, 0xa0,       //     2010-03-27 19:00Z +08:00 DST
+	0xa0, 0x89, 0x13, 0x1c,       //     2010-10-30 19:00Z +07:00
+	0xe0, 0xf5, 0x0c, 0x20,       //     2011-03-26 19:00Z +08:00
+	0xe4, 0x85, 0x73, 0x1c,       //     2014-10-25 18:00Z +07:00 rules
+	0x00, 0x20,                   // AWST 2000-01-01 00:00Z +08:00
+	0x98, 0x95, 0xde, 0x01, 0xa4, //     2006-12-02 18:00Z +09:00 DST
+	0x80, 0xec, 0x09, 0x20,       //     2007-03-24 18:00Z +08:00
+	0xa0, 0x89, 0x13, 0xa4,       //     2007-10-27 18:00Z +09:00 DST
+	0xc0, 0xc4, 0x0d, 0x20,       //     2008-03-29 18:00Z +08:00
+	0xc0, 0xba, 0x12, 0xa4,       //     2008-10-25 18:00Z +09:00 DST
+	0xc0, 0xc4, 0x0d, 0x20,       //     2009-03-28 18:00Z +08:00 rules
+	0x00, 0x20,                   // CHOT 2000-01-01 00:00Z +08:00
+	0xf8, 0xb6, 0x2a, 0xa4,       //     2001-04-27 18:00Z +09:00 DST
+	0x84, 0xc4, 0x0d, 0x20,       //     2001-09-28 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2002-03-29 18:00Z +09:00 DST
+	0x84, 0xff, 0x0f, 0x20,       //     2002-09-27 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2003-03-28 18:00Z +09:00 DST
+	0x84, 0xff, 0x0f, 0x20,       //     2003-09-26 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2004-03-26 18:00Z +09:00 DST
+	0x84, 0xff, 0x0f, 0x20,       //     2004-09-24 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2005-03-25 18:00Z +09:00 DST
+	0x84, 0xff, 0x0f, 0x20,       //     2005-09-23 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2006-03-24 18:00Z +09:00 DST
+	0xe4, 0xcd, 0x10, 0x20,       //     2006-09-29 17:00Z +08:00
+	0xdc, 0xc6, 0x90, 0x02, 0xa4, //     2015-03-27 18:00Z +09:00 DST
+	0x8c, 0xfe, 0x0f, 0x20,       //     2015-09-25 15:00Z +08:00
+	0xf4, 0x80, 0x10, 0xa4,       //     2016-03-25 18:00Z +09:00 DST
+	0x8c, 0xfe, 0x0f, 0x20,       //     2016-09-23 15:00Z +08:00 rules
+	0x00, 0x20,                   // IRKT 2000-01-01 00:00Z +08:00
+	0xb8, 0xb9, 0x07, 0xa4,       //     2000-03-25 18:00Z +09:00 DST
+	0xa0, 0x89, 0x13, 0x20,       //     2000-10-28 18:00Z +08:00
+	0xe0, 0xf5, 0x0c, 0xa4,       //     2001-03-24 18:00Z +09:00 DST
+	0xa0, 0x89, 0x13, 0x20,       //     2001-10-27 18:00Z +08:00
+	0xc0, 0xc4, 0x0d, 0xa4,       //     2002-03-30 18:00Z +09:00 DST
+	0xc0, 0xba, 0x12, 0x20,       //     2002-10-26 18:00Z +08:00
+	0xc0, 0xc4, 0x0d, 0xa4,       //     2003-03-29 18:00Z +09:00 DST
+	0xc0, 0xba, 0x12, 0x20,       //     2003-10-25 18:00Z +08:00
+	0xc0, 0xc4, 0x0d, 0xa4,       //     2004-03-27 18:00Z +09:00 DST
+	0xa0, 0x89, 0x13, 0x20,       //     2004-10-30 18:00Z +08:00
+	0xe0, 0xf5, 0x0c, 0xa4,       //     2005-03-26 18:00Z +09:00 DST
+	0xa0, 0x89, 0x13, 0x20,       //     2005-10-29 18:00Z +08:00
+	0xe0, 0xf5, 0x0c, 0xa4,       //     2006-03-25 18:00Z +09:00 DST
+	0xa0, 0x89, 0x13, 0x20,       //     2006-10-28 18:00Z +08:00
+	0xe0, 0xf5, 0x0c, 0xa4,       //     2007-03-24 18:00Z +09:00 DST
+	0xa0, 0x89, 0x13, 0x20,       //     2007-10-27 18:00Z +08:00
+	0xc0, 0xc4, 0x0d, 0xa4,       //     2008-03-29 18:00Z +09:00 DST
+	0xc0, 0xba, 0x12, 0x20,       //     2008-10-25 18:00Z +08:00
+	0xc0, 0xc4, 0x0d, 0xa4,       //     2009-03-28 18:00Z +09:00 DST
+	0xc0, 0xba, 0x12, 0x20,       //     2009-10-24 18:00Z +08:00
+	0xc0, 0xc4, 0x0d, 0xa4,       //     2010-03-27 18:00Z +09:00 DST
+	0xa0, 0x89, 0x13, 0x20,       //     2010-10-30 18:00Z +08:00
+	0xe0, 0xf5, 0x0c, 0x24,       //     2011-03-26 18:00Z +09:00
+	0xe4, 0x85, 0x73, 0x20,       //     2014-10-25 17:00Z +08:00 rules
+	0x00, 0x20,                   // ULAT 2000-01-01 00:00Z +08:00
+	0xf8, 0xb6, 0x2a, 0xa4,       //     2001-04-27 18:00Z +09:00 DST
+	0x84, 0xc4, 0x0d, 0x20,       //     2001-09-28 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2002-03-29 18:00Z +09:00 DST
+	0x84, 0xff, 0x0f, 0x20,       //     2002-09-27 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2003-03-28 18:00Z +09:00 DST
+	0x84, 0xff, 0x0f, 0x20,       //     2003-09-26 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2004-03-26 18:00Z +09:00 DST
+	0x84, 0xff, 0x0f, 0x20,       //     2004-09-24 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2005-03-25 18:00Z +09:00 DST
+	0x84, 0xff, 0x0f, 0x20,       //     2005-09-23 17:00Z +08:00
+	0xfc, 0xff, 0x0f, 0xa4,       //     2006-03-24 18:00Z +09:00 DST
+	0xe4, 0xcd, 0x10, 0x20,       //     2006-09-29 17:00Z +08:00
+	0xdc, 0xc6, 0x90, 0x02, 0xa4, //     2015-03-27 18:00Z +09:00 DST
+	0x8c, 0xfe, 0x0f, 0x20,       //     2015-09-25 15:00Z +08:00
+	0xf4, 0x80, 0x10, 0xa4,       //     2016-03-25 18:00Z +09:00 DST
+	0x8c, 0xfe, 0x0f, 0x20,       //     2016-09-23 15:00Z +08:00 rules
+	0x00, 0x20,                   // WST 2000-01-01 00:00Z +08:00
+	0x98, 0x95, 0xde, 0x01, 0xa4, //     2006-12-02 18:00Z +09:00 DST
+	0x80, 0xec, 0x09, 0x20,       //     2007-03-24 18:00Z +08:00
+	0xa0, 0x89, 0x13, 0xa4,       //     2007-10-27 18:00Z +09:00 DST
+	0xc0, 0xc4, 0x0d, 0x20,       //     2008-03-29 18:00Z +08:00
+	0xc0, 0xba, 0x12, 0xa4,       //     2008-10-25 18:00Z +09:00 DST
+	0xc0, 0xc4, 0x0d, 0x20,       //     2009-03-28 18:00Z +08:00 rules
+	0x00, 0x20,                   // TLT 2000-01-01 00:00Z +08:00
+	0xa0, 0xe9, 0x16, 0x24,       //     2000-09-16 16:00Z +09:00 rules
+	0x00, 0x24,                   // YAKT 2000-01-01 00:00Z +09:00
+	0xfc, 0xb8, 0x07, 0xa8,       //     2000-03-25 17:00Z +10:00 DST
+	0xa0, 0x89, 0x13, 0x24,       //     2000-10-28 17:00Z +09:00
+	0xe0, 0xf5, 0x0c, 0xa8,       //     2001-03-24 17:00Z +10:00 DST
+	0xa0, 0x89, 0x13, 0x24,       //     2001-10-27 17:00Z +09:00
+	0xc0, 0xc4, 0x0d, 0xa8,       //     2002-03-30 17:00Z +10:00 DST
+	0xc0, 0xba, 0x12, 0x24,       //     2002-10-26 17:00Z +09:00
+	0xc0, 0xc4, 0x0d, 0xa8,       //     2003-03-29 17:00Z +10:00 DST
+	0xc0, 0xba, 0x12, 0x24,       //     2003-10-25 17:00Z +09:00
+	0xc0, 0xc4, 0x0d, 0xa8,       //     2004-03-27 17:00Z +10:00 DST
+	0xa0, 0x89, 0x13, 0x24,       //     2004-10-30 17:00Z +09:00
+	0xe0, 0xf5, 0x0c, 0xa8,       //     2005-03-26 17:00Z +10:00 DST
+	0xa0, 0x89, 0x13, 0x24,       //     2005-10-29 17:00Z +09:00
+	0xe0, 0xf5, 0x0c, 0xa8,       //     2006-03-25 17:00Z +10:00 DST
+	0xa0, 0x89, 0x13, 0x24,       //     2006-10-28 17:00Z +09:00
+	0xe0, 0xf5, 0x0c, 0xa8,       //     2007-03-24 17:00Z +10:00 DST
+	0xa0, 0x89, 0x13, 0x24,       //     2007-10-27 17:00Z +09:00
+	0xc0, 0xc4, 0x0d, 0xa8,       //     2008-03-29 17:00Z +10:00 DST
+	0xc0, 0xba, 0x12, 0x24,       //     2008-10-25 17:00Z +09:00
+	0xc0, 0xc4, 0x0d, 0xa8,       //     2009-03-28 17:00Z +10:00 DST
+	0xc0, 0xba, 0x12, 0x24,       //     2009-10-24 17:00Z +09:00
+	0xc0, 0xc4, 0x0d, 0xa8,       //     2010-03-27 17:00Z +10:00 DST
+	0xa0, 0x89, 0x13, 0x24,       //     2010-10-30 17:00Z +09:00
+	0xe0, 0xf5, 0x0c, 0x28,       //     2011-03-26 17:00Z +10:00
+	0xe4, 0x85, 0x73, 0x24,       //     2014-10-25 16:00Z +09:00 rules
+	0x00, 0xaa,                   // ACST 2000-01-01 00:00Z +10:30 DST
+	0xde, 0xb8, 0x07, 0x26,       //     2000-03-25 16:30Z +09:30
+	0xa0, 0x89, 0x13, 0xaa,       //     2000-10-28 16:30Z +10:30 DST
+	0xe0, 0xf5, 0x0c, 0x26,       //     2001-03-24 16:30Z +09:30
+	0xa0, 0x89, 0x13, 0xaa,       //     2001-10-27 16:30Z +10:30 DST
+	0xc0, 0xc4, 0x0d, 0x26,       //     2002-03-30 16:30Z +09:30
+	0xc0, 0xba, 0x12, 0xaa,       //     2002-10-26 16:30Z +10:30 DST
+	0xc0, 0xc4, 0x0d, 0x26,       //     2003-03-29 16:30Z +09:30
+	0xc0, 0xba, 0x12, 0xaa,       //     2003-10-25 16:30Z +10:30 DST
+	0xc0, 0xc4, 0x0d, 0x26,       //     2004-03-27 16:30Z +09:30
+	0xa0, 0x89, 0x13, 0xaa,       //     2004-10-30 16:30Z +10:30 DST
+	0xe0, 0xf5, 0x0c, 0x26,       //     2005-03-26 16:30Z +09:30
+	0xa0, 0x89, 0x13, 0xaa,       //     2005-10-29 16:30Z +10:30 DST
+	0xc0, 0xc4, 0x0d, 0x26,       //     2006-04-01 16:30Z +09:30
+	0xc0, 0xba, 0x12, 0xaa,       //     2006-10-28 16:30Z +10:30 DST
+	0xe0, 0xf5, 0x0c, 0x26,       //     2007-03-24 16:30Z +09:30
+	0xa0, 0x89, 0x13, 0xaa,       //     2007-10-27 16:30Z +10:30 rules
+	0x00, 0xac,                   // AEST 2000-01-01 00:00Z +11:00 DST
+	0xc0, 0xb8, 0x07, 0x28,       //     2000-03-25 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2000-08-26 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2001-03-24 16:00Z +10:00
+	0xa0, 0x89, 0x13, 0xac,       //     2001-10-27 16:00Z +11:00 DST
+	0xc0, 0xc4, 0x0d, 0x28,       //     2002-03-30 16:00Z +10:00
+	0xc0, 0xba, 0x12, 0xac,       //     2002-10-26 16:00Z +11:00 DST
+	0xc0, 0xc4, 0x0d, 0x28,       //     2003-03-29 16:00Z +10:00
+	0xc0, 0xba, 0x12, 0xac,       //     2003-10-25 16:00Z +11:00 DST
+	0xc0, 0xc4, 0x0d, 0x28,       //     2004-03-27 16:00Z +10:00
+	0xa0, 0x89, 0x13, 0xac,       //     2004-10-30 16:00Z +11:00 DST
+	0xe0, 0xf5, 0x0c, 0x28,       //     2005-03-26 16:00Z +10:00
+	0xa0, 0x89, 0x13, 0xac,       //     2005-10-29 16:00Z +11:00 DST
+	0xc0, 0xc4, 0x0d, 0x28,       //     2006-04-01 16:00Z +10:00
+	0xc0, 0xba, 0x12, 0xac,       //     2006-10-28 16:00Z +11:00 DST
+	0xe0, 0xf5, 0x0c, 0x28,       //     2007-03-24 16:00Z +10:00
+	0xa0, 0x89, 0x13, 0xac,       //     2007-10-27 16:00Z +11:00 rules
+	0x00, 0x28,                   // VLAT 2000-01-01 00:00Z +10:00
+	0xc0, 0xb8, 0x07, 0xac,       //     2000-03-25 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2000-10-28 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0xac,       //     2001-03-24 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2001-10-27 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2002-03-30 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2002-10-26 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2003-03-29 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2003-10-25 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2004-03-27 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2004-10-30 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0xac,       //     2005-03-26 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2005-10-29 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0xac,       //     2006-03-25 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2006-10-28 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0xac,       //     2007-03-24 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2007-10-27 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2008-03-29 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2008-10-25 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2009-03-28 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2009-10-24 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2010-03-27 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2010-10-30 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0x2c,       //     2011-03-26 16:00Z +11:00
+	0xe4, 0x85, 0x73, 0x28,       //     2014-10-25 15:00Z +10:00 rules
+	0x00, 0xac,                   // LHST 2000-01-01 00:00Z +11:00 DST
+	0x84, 0xb8, 0x07, 0x2a,       //     2000-03-25 15:00Z +10:30
+	0xde, 0xc4, 0x0d, 0xac,       //     2000-08-26 15:30Z +11:00 DST
+	0xa2, 0xba, 0x12, 0x2a,       //     2001-03-24 15:00Z +10:30
+	0xbe, 0x89, 0x13, 0xac,       //     2001-10-27 15:30Z +11:00 DST
+	0xa2, 0xc4, 0x0d, 0x2a,       //     2002-03-30 15:00Z +10:30
+	0xde, 0xba, 0x12, 0xac,       //     2002-10-26 15:30Z +11:00 DST
+	0xa2, 0xc4, 0x0d, 0x2a,       //     2003-03-29 15:00Z +10:30
+	0xde, 0xba, 0x12, 0xac,       //     2003-10-25 15:30Z +11:00 DST
+	0xa2, 0xc4, 0x0d, 0x2a,       //     2004-03-27 15:00Z +10:30
+	0xbe, 0x89, 0x13, 0xac,       //     2004-10-30 15:30Z +11:00 DST
+	0xc2, 0xf5, 0x0c, 0x2a,       //     2005-03-26 15:00Z +10:30
+	0xbe, 0x89, 0x13, 0xac,       //     2005-10-29 15:30Z +11:00 DST
+	0xa2, 0xc4, 0x0d, 0x2a,       //     2006-04-01 15:00Z +10:30
+	0xde, 0xba, 0x12, 0xac,       //     2006-10-28 15:30Z +11:00 DST
+	0xc2, 0xf5, 0x0c, 0x2a,       //     2007-03-24 15:00Z +10:30
+	0xbe, 0x89, 0x13, 0xac,       //     2007-10-27 15:30Z +11:00 rules
+	0x00, 0xac,                   // MIST 2000-01-01 00:00Z +11:00 DST
+	0xc0, 0xb8, 0x07, 0x28,       //     2000-03-25 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2000-08-26 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2001-03-24 16:00Z +10:00
+	0x80, 0x9d, 0x11, 0xac,       //     2001-10-06 16:00Z +11:00 DST
+	0xe0, 0xb0, 0x0f, 0x28,       //     2002-03-30 16:00Z +10:00
+	0xa0, 0xce, 0x10, 0xac,       //     2002-10-05 16:00Z +11:00 DST
+	0xe0, 0xb0, 0x0f, 0x28,       //     2003-03-29 16:00Z +10:00
+	0xa0, 0xce, 0x10, 0xac,       //     2003-10-04 16:00Z +11:00 DST
+	0xe0, 0xb0, 0x0f, 0x28,       //     2004-03-27 16:00Z +10:00
+	0xa0, 0xce, 0x10, 0xac,       //     2004-10-02 16:00Z +11:00 DST
+	0xe0, 0xb0, 0x0f, 0x28,       //     2005-03-26 16:00Z +10:00
+	0xa0, 0xce, 0x10, 0xac,       //     2005-10-01 16:00Z +11:00 DST
+	0xc0, 0xff, 0x0f, 0x28,       //     2006-04-01 16:00Z +10:00
+	0xc0, 0xff, 0x0f, 0xac,       //     2006-09-30 16:00Z +11:00 DST
+	0xe0, 0xb0, 0x0f, 0x28,       //     2007-03-24 16:00Z +10:00
+	0x80, 0x9d, 0x11, 0xac,       //     2007-10-06 16:00Z +11:00 DST
+	0xc0, 0xff, 0x0f, 0x28,       //     2008-04-05 16:00Z +10:00
+	0xc0, 0xff, 0x0f, 0xac,       //     2008-10-04 16:00Z +11:00 DST
+	0xc0, 0xff, 0x0f, 0x28,       //     2009-04-04 16:00Z +10:00
+	0xc0, 0xff, 0x0f, 0xac,       //     2009-10-03 16:00Z +11:00 DST
+	0xc0, 0xfe, 0x2f, 0x28,       //     2011-04-02 16:00Z +10:00 rules
+	0x00, 0x28,                   // SAKT 2000-01-01 00:00Z +10:00
+	0xc0, 0xb8, 0x07, 0xac,       //     2000-03-25 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2000-10-28 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0xac,       //     2001-03-24 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2001-10-27 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2002-03-30 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2002-10-26 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2003-03-29 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2003-10-25 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2004-03-27 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2004-10-30 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0xac,       //     2005-03-26 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2005-10-29 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0xac,       //     2006-03-25 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2006-10-28 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0xac,       //     2007-03-24 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2007-10-27 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2008-03-29 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2008-10-25 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2009-03-28 16:00Z +11:00 DST
+	0xc0, 0xba, 0x12, 0x28,       //     2009-10-24 16:00Z +10:00
+	0xc0, 0xc4, 0x0d, 0xac,       //     2010-03-27 16:00Z +11:00 DST
+	0xa0, 0x89, 0x13, 0x28,       //     2010-10-30 16:00Z +10:00
+	0xe0, 0xf5, 0x0c, 0x2c,       //     2011-03-26 16:00Z +11:00
+	0xe4, 0x85, 0x73, 0x28,       //     2014-10-25 15:00Z +10:00
+	0xfc, 0xc3, 0x2d, 0x2c,       //     2016-03-26 16:00Z +11:00 rules
+	0x00, 0x2c,                   // SRET 2000-01-01 00:00Z +11:00
+	0x84, 0xb8, 0x07, 0xb0,       //     2000-03-25 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2000-10-28 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0xb0,       //     2001-03-24 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2001-10-27 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2002-03-30 15:00Z +12:00 DST
+	0xc0, 0xba, 0x12, 0x2c,       //     2002-10-26 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2003-03-29 15:00Z +12:00 DST
+	0xc0, 0xba, 0x12, 0x2c,       //     2003-10-25 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2004-03-27 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2004-10-30 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0xb0,       //     2005-03-26 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2005-10-29 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0xb0,       //     2006-03-25 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2006-10-28 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0xb0,       //     2007-03-24 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2007-10-27 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2008-03-29 15:00Z +12:00 DST
+	0xc0, 0xba, 0x12, 0x2c,       //     2008-10-25 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2009-03-28 15:00Z +12:00 DST
+	0xc0, 0xba, 0x12, 0x2c,       //     2009-10-24 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2010-03-27 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2010-10-30 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0x30,       //     2011-03-26 15:00Z +12:00
+	0xe4, 0x85, 0x73, 0x2c,       //     2014-10-25 14:00Z +11:00 rules
+	0x00, 0x2e,                   // NFT 2000-01-01 00:00Z +11:30
+	0xa6, 0xe3, 0xf9, 0x03, 0x2c, //     2015-10-03 14:30Z +11:00
+	0xfe, 0xca, 0x80, 0x01, 0xb0, //     2019-10-05 15:00Z +12:00 rules
+	0x00, 0xb4,                   // FJT 2000-01-01 00:00Z +13:00 DST
+	0xc8, 0xfc, 0x04, 0x30,       //     2000-02-26 14:00Z +12:00
+	0xe0, 0x93, 0xb9, 0x02, 0xb4, //     2009-11-28 14:00Z +13:00 DST
+	0xe0, 0xba, 0x0a, 0x30,       //     2010-03-27 14:00Z +12:00
+	0xc0, 0xba, 0x12, 0xb4,       //     2010-10-23 14:00Z +13:00 DST
+	0xa0, 0xd8, 0x0b, 0x30,       //     2011-03-05 14:00Z +12:00
+	0xe0, 0xa6, 0x14, 0xb4,       //     2011-10-22 14:00Z +13:00 DST
+	0xe0, 0xff, 0x07, 0x30,       //     2012-01-21 14:00Z +12:00
+	0xa0, 0xff, 0x17, 0xb4,       //     2012-10-20 14:00Z +13:00 DST
+	0xe0, 0xff, 0x07, 0x30,       //     2013-01-19 14:00Z +12:00
+	0x80, 0xce, 0x18, 0xb4,       //     2013-10-26 14:00Z +13:00 DST
+	0xc4, 0xb0, 0x07, 0x30,       //     2014-01-18 13:00Z +12:00
+	0x9c, 0x9d, 0x19, 0xb4,       //     2014-11-01 14:00Z +13:00 DST
+	0xa0, 0xe2, 0x06, 0x30,       //     2015-01-17 14:00Z +12:00
+	0xe0, 0x9c, 0x19, 0xb4,       //     2015-10-31 14:00Z +13:00 DST
+	0xa0, 0xe2, 0x06, 0x30,       //     2016-01-16 14:00Z +12:00
+	0xc0, 0xeb, 0x19, 0xb4,       //     2016-11-05 14:00Z +13:00 DST
+	0xc0, 0x93, 0x06, 0x30,       //     2017-01-14 14:00Z +12:00
+	0xc0, 0xeb, 0x19, 0xb4,       //     2017-11-04 14:00Z +13:00 DST
+	0xc0, 0x93, 0x06, 0x30,       //     2018-01-13 14:00Z +12:00
+	0xc0, 0xeb, 0x19, 0xb4,       //     2018-11-03 14:00Z +13:00 DST
+	0xc0, 0x93, 0x06, 0x30,       //     2019-01-12 14:00Z +12:00
+	0xa0, 0xba, 0x1a, 0xb4,       //     2019-11-09 14:00Z +13:00 DST
+	0xe0, 0xc4, 0x05, 0x30,       //     2020-01-11 14:00Z +12:00
+	0xe0, 0x92, 0x1e, 0xb4,       //     2020-12-19 14:00Z +13:00 DST
+	0x80, 0xbb, 0x02, 0x30,       //     2021-01-16 14:00Z +12:00 rules
+	0x00, 0x2c,                   // MAGT 2000-01-01 00:00Z +11:00
+	0x84, 0xb8, 0x07, 0xb0,       //     2000-03-25 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2000-10-28 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0xb0,       //     2001-03-24 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2001-10-27 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2002-03-30 15:00Z +12:00 DST
+	0xc0, 0xba, 0x12, 0x2c,       //     2002-10-26 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2003-03-29 15:00Z +12:00 DST
+	0xc0, 0xba, 0x12, 0x2c,       //     2003-10-25 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2004-03-27 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2004-10-30 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0xb0,       //     2005-03-26 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2005-10-29 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0xb0,       //     2006-03-25 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2006-10-28 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0xb0,       //     2007-03-24 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2007-10-27 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2008-03-29 15:00Z +12:00 DST
+	0xc0, 0xba, 0x12, 0x2c,       //     2008-10-25 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2009-03-28 15:00Z +12:00 DST
+	0xc0, 0xba, 0x12, 0x2c,       //     2009-10-24 15:00Z +11:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2010-03-27 15:00Z +12:00 DST
+	0xa0, 0x89, 0x13, 0x2c,       //     2010-10-30 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0x30,       //     2011-03-26 15:00Z +12:00
+	0xe4, 0x85, 0x73, 0x28,       //     2014-10-25 14:00Z +10:00
+	0xb8, 0xff, 0x2f, 0x2c,       //     2016-04-23 16:00Z +11:00 rules
+	0x00, 0xb4,                   // NZST 2000-01-01 00:00Z +13:00 DST
+	0xe8, 0xe8, 0x06, 0x30,       //     2000-03-18 14:00Z +12:00
+	0x80, 0x9d, 0x11, 0xb4,       //     2000-09-30 14:00Z +13:00 DST
+	0x80, 0xe2, 0x0e, 0x30,       //     2001-03-17 14:00Z +12:00
+	0xe0, 0xeb, 0x11, 0xb4,       //     2001-10-06 14:00Z +13:00 DST
+	0xa0, 0x93, 0x0e, 0x30,       //     2002-03-16 14:00Z +12:00
+	0xe0, 0xeb, 0x11, 0xb4,       //     2002-10-05 14:00Z +13:00 DST
+	0xa0, 0x93, 0x0e, 0x30,       //     2003-03-15 14:00Z +12:00
+	0xe0, 0xeb, 0x11, 0xb4,       //     2003-10-04 14:00Z +13:00 DST
+	0x80, 0xe2, 0x0e, 0x30,       //     2004-03-20 14:00Z +12:00
+	0x80, 0x9d, 0x11, 0xb4,       //     2004-10-02 14:00Z +13:00 DST
+	0x80, 0xe2, 0x0e, 0x30,       //     2005-03-19 14:00Z +12:00
+	0x80, 0x9d, 0x11, 0xb4,       //     2005-10-01 14:00Z +13:00 DST
+	0x80, 0xe2, 0x0e, 0x30,       //     2006-03-18 14:00Z +12:00
+	0x80, 0x9d, 0x11, 0xb4,       //     2006-09-30 14:00Z +13:00 DST
+	0x80, 0xe2, 0x0e, 0x30,       //     2007-03-17 14:00Z +12:00
+	0x80, 0x9d, 0x11, 0xb4,       //     2007-09-29 14:00Z +13:00 rules
+	0x00, 0x30,                   // PETT 2000-01-01 00:00Z +12:00
+	0xc8, 0xb7, 0x07, 0xb4,       //     2000-03-25 14:00Z +13:00 DST
+	0xa0, 0x89, 0x13, 0x30,       //     2000-10-28 14:00Z +12:00
+	0xe0, 0xf5, 0x0c, 0xb4,       //     2001-03-24 14:00Z +13:00 DST
+	0xa0, 0x89, 0x13, 0x30,       //     2001-10-27 14:00Z +12:00
+	0xc0, 0xc4, 0x0d, 0xb4,       //     2002-03-30 14:00Z +13:00 DST
+	0xc0, 0xba, 0x12, 0x30,       //     2002-10-26 14:00Z +12:00
+	0xc0, 0xc4, 0x0d, 0xb4,       //     2003-03-29 14:00Z +13:00 DST
+	0xc0, 0xba, 0x12, 0x30,       //     2003-10-25 14:00Z +12:00
+	0xc0, 0xc4, 0x0d, 0xb4,       //     2004-03-27 14:00Z +13:00 DST
+	0xa0, 0x89, 0x13, 0x30,       //     2004-10-30 14:00Z +12:00
+	0xe0, 0xf5, 0x0c, 0xb4,       //     2005-03-26 14:00Z +13:00 DST
+	0xa0, 0x89, 0x13, 0x30,       //     2005-10-29 14:00Z +12:00
+	0xe0, 0xf5, 0x0c, 0xb4,       //     2006-03-25 14:00Z +13:00 DST
+	0xa0, 0x89, 0x13, 0x30,       //     2006-10-28 14:00Z +12:00
+	0xe0, 0xf5, 0x0c, 0xb4,       //     2007-03-24 14:00Z +13:00 DST
+	0xa0, 0x89, 0x13, 0x30,       //     2007-10-27 14:00Z +12:00
+	0xc0, 0xc4, 0x0d, 0xb4,       //     2008-03-29 14:00Z +13:00 DST
+	0xc0, 0xba, 0x12, 0x30,       //     2008-10-25 14:00Z +12:00
+	0xc0, 0xc4, 0x0d, 0xb4,       //     2009-03-28 14:00Z +13:00 DST
+	0xc0, 0xba, 0x12, 0x30,       //     2009-10-24 14:00Z +12:00
+	0xc0, 0xc4, 0x0d, 0xb0,       //     2010-03-27 14:00Z +12:00 DST
+	0xdc, 0x89, 0x13, 0x2c,       //     2010-10-30 15:00Z +11:00
+	0xe0, 0xf5, 0x0c, 0x30,       //     2011-03-26 15:00Z +12:00 rules
+	0x00, 0xb7,                   // CHAST 2000-01-01 00:00Z +13:45 DST
+	0xe8, 0xe8, 0x06, 0x33,       //     2000-03-18 14:00Z +12:45
+	0x80, 0x9d, 0x11, 0xb7,       //     2000-09-30 14:00Z +13:45 DST
+	0x80, 0xe2, 0x0e, 0x33,       //     2001-03-17 14:00Z +12:45
+	0xe0, 0xeb, 0x11, 0xb7,       //     2001-10-06 14:00Z +13:45 DST
+	0xa0, 0x93, 0x0e, 0x33,       //     2002-03-16 14:00Z +12:45
+	0xe0, 0xeb, 0x11, 0xb7,       //     2002-10-05 14:00Z +13:45 DST
+	0xa0, 0x93, 0x0e, 0x33,       //     2003-03-15 14:00Z +12:45
+	0xe0, 0xeb, 0x11, 0xb7,       //     2003-10-04 14:00Z +13:45 DST
+	0x80, 0xe2, 0x0e, 0x33,       //     2004-03-20 14:00Z +12:45
+	0x80, 0x9d, 0x11, 0xb7,       //     2004-10-02 14:00Z +13:45 DST
+	0x80, 0xe2, 0x0e, 0x33,       //     2005-03-19 14:00Z +12:45
+	0x80, 0x9d, 0x11, 0xb7,       //     2005-10-01 14:00Z +13:45 DST
+	0x80, 0xe2, 0x0e, 0x33,       //     2006-03-18 14:00Z +12:45
+	0x80, 0x9d, 0x11, 0xb7,       //     2006-09-30 14:00Z +13:45 DST
+	0x80, 0xe2, 0x0e, 0x33,       //     2007-03-17 14:00Z +12:45
+	0x80, 0x9d, 0x11, 0xb7,       //     2007-09-29 14:00Z +13:45 rules
+	0x00, 0x54,                   // TKT 2000-01-01 00:00Z -11:00
+	0xb4, 0x8b, 0x81, 0x03, 0x34, //     2011-12-30 11:00Z +13:00 rules
+	0x00, 0xb8,                   // TOT 2000-01-01 00:00Z +14:00 DST
+	0xac, 0xe8, 0x06, 0x34,       //     2000-03-18 13:00Z +13:00
+	0xe0, 0xa6, 0x14, 0xb8,       //     2000-11-04 13:00Z +14:00 DST
+	0xc4, 0xb0, 0x07, 0x34,       //     2001-01-27 12:00Z +13:00
+	0xbc, 0xce, 0x18, 0xb8,       //     2001-11-03 13:00Z +14:00 DST
+	0xc4, 0xb0, 0x07, 0x34,       //     2002-01-26 12:00Z +13:00
+	0xdc, 0xac, 0xda, 0x03, 0xb8, //     2016-11-05 13:00Z +14:00 DST
+	0xc0, 0x93, 0x06, 0x34,       //     2017-01-14 13:00Z +13:00 rules
+	0x00, 0x7c,                   // EGT 2000-01-01 00:00Z -01:00
+	0xdc, 0xbc, 0x07, 0x80,       //     2000-03-26 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2000-10-29 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2001-03-25 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2001-10-28 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2002-03-31 01:00Z +00:00 DST
+	0xc0, 0xba, 0x12, 0x7c,       //     2002-10-27 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2003-03-30 01:00Z +00:00 DST
+	0xc0, 0xba, 0x12, 0x7c,       //     2003-10-26 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2004-03-28 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2004-10-31 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2005-03-27 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2005-10-30 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2006-03-26 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2006-10-29 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2007-03-25 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2007-10-28 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2008-03-30 01:00Z +00:00 DST
+	0xc0, 0xba, 0x12, 0x7c,       //     2008-10-26 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2009-03-29 01:00Z +00:00 DST
+	0xc0, 0xba, 0x12, 0x7c,       //     2009-10-25 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2010-03-28 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2010-10-31 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2011-03-27 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2011-10-30 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2012-03-25 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2012-10-28 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2013-03-31 01:00Z +00:00 DST
+	0xc0, 0xba, 0x12, 0x7c,       //     2013-10-27 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2014-03-30 01:00Z +00:00 DST
+	0xc0, 0xba, 0x12, 0x7c,       //     2014-10-26 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2015-03-29 01:00Z +00:00 DST
+	0xc0, 0xba, 0x12, 0x7c,       //     2015-10-25 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2016-03-27 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2016-10-30 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2017-03-26 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2017-10-29 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2018-03-25 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2018-10-28 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2019-03-31 01:00Z +00:00 DST
+	0xc0, 0xba, 0x12, 0x7c,       //     2019-10-27 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2020-03-29 01:00Z +00:00 DST
+	0xc0, 0xba, 0x12, 0x7c,       //     2020-10-25 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0x80,       //     2021-03-28 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2021-10-31 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2022-03-27 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2022-10-30 01:00Z -01:00
+	0xe0, 0xf5, 0x0c, 0x80,       //     2023-03-26 01:00Z +00:00 DST
+	0xa0, 0x89, 0x13, 0x7c,       //     2023-10-29 01:00Z -01:00
+	0xc0, 0xc4, 0x0d, 0xfc,       //     2024-03-31 01:00Z -01:00 rules
+	0x00, 0xfc,                   // FNT 2000-01-01 00:00Z -01:00 DST
+	0xdc, 0x81, 0x05, 0x78,       //     2000-02-27 01:00Z -02:00
+	0xbc, 0xd8, 0x13, 0xfc,       //     2000-10-08 02:00Z -01:00 DST
+	0xa4, 0x4e, 0x78,             //     2000-10-15 01:00Z -02:00
+	0xbc, 0xff, 0x1f, 0xfc,       //     2001-10-14 02:00Z -01:00 DST
+	0x84, 0x89, 0x0b, 0x78,       //     2002-02-17 01:00Z -02:00 rules
+	0x00, 0xf4,                   // ART 2000-01-01 00:00Z -03:00 DST
+	0xf4, 0xba, 0x05, 0x74,       //     2000-03-03 03:00Z -03:00
+	0xc0, 0x98, 0xfb, 0x01, 0xf8, //     2007-12-30 03:00Z -02:00 DST
+	0xe4, 0xe1, 0x06, 0x74,       //     2008-03-16 02:00Z -03:00
+	0xdc, 0x89, 0x13, 0xf8,       //     2008-10-19 03:00Z -02:00 DST
+	0xa4, 0xf5, 0x0c, 0x74,       //     2009-03-15 02:00Z -03:00 rules
+	0x00, 0xf8,                   // BRT 2000-01-01 00:00Z -02:00 DST
+	0x98, 0x82, 0x05, 0x74,       //     2000-02-27 02:00Z -03:00
+	0xbc, 0xd8, 0x13, 0xf8,       //     2000-10-08 03:00Z -02:00 DST
+	0xe4, 0xd7, 0x0b, 0x74,       //     2001-02-18 02:00Z -03:00
+	0xfc, 0xf5, 0x14, 0xf8,       //     2001-10-14 03:00Z -02:00 DST
+	0x84, 0x89, 0x0b, 0x74,       //     2002-02-17 02:00Z -03:00
+	0x9c, 0xe2, 0x16, 0xf8,       //     2002-11-03 03:00Z -02:00 DST
+	0xe4, 0x9c, 0x09, 0x74,       //     2003-02-16 02:00Z -03:00
+	0xdc, 0xc4, 0x15, 0xf8,       //     2003-10-19 03:00Z -02:00 DST
+	0xa4, 0xba, 0x0a, 0x74,       //     2004-02-15 02:00Z -03:00
+	0xdc, 0xf8, 0x16, 0xf8,       //     2004-11-02 03:00Z -02:00 DST
+	0x84, 0xd5, 0x09, 0x74,       //     2005-02-20 02:00Z -03:00
+	0xfc, 0xf5, 0x14, 0xf8,       //     2005-10-16 03:00Z -02:00 DST
+	0x84, 0x89, 0x0b, 0x74,       //     2006-02-19 02:00Z -03:00
+	0x9c, 0xe2, 0x16, 0xf8,       //     2006-11-05 03:00Z -02:00 DST
+	0xc4, 0xeb, 0x09, 0x74,       //     2007-02-25 02:00Z -03:00
+	0x9c, 0xa7, 0x14, 0xf8,       //     2007-10-14 03:00Z -02:00 DST
+	0x84, 0x89, 0x0b, 0x74,       //     2008-02-17 02:00Z -03:00
+	0xdc, 0xc4, 0x15, 0xf8,       //     2008-10-19 03:00Z -02:00 DST
+	0xa4, 0xba, 0x0a, 0x74,       //     2009-02-15 02:00Z -03:00
+	0xdc, 0xc4, 0x15, 0xf8,       //     2009-10-18 03:00Z -02:00 DST
+	0x84, 0x89, 0x0b, 0x74,       //     2010-02-21 02:00Z -03:00
+	0xfc, 0xf5, 0x14, 0xf8,       //     2010-10-17 03:00Z -02:00 DST
+	0x84, 0x89, 0x0b, 0x74,       //     2011-02-20 02:00Z -03:00
+	0xfc, 0xf5, 0x14, 0xf8,       //     2011-10-16 03:00Z -02:00 DST
+	0xe4, 0xd7, 0x0b, 0x74,       //     2012-02-26 02:00Z -03:00
+	0xfc, 0xf5, 0x14, 0xf8,       //     2012-10-21 03:00Z -02:00 DST
+	0xa4, 0xba, 0x0a, 0x74,       //     2013-02-17 02:00Z -03:00
+	0xdc, 0xc4, 0x15, 0xf8,       //     2013-10-20 03:00Z -02:00 DST
+	0xa4, 0xba, 0x0a, 0x74,       //     2014-02-16 02:00Z -03:00
+	0xdc, 0xc4, 0x15, 0xf8,       //     2014-10-19 03:00Z -02:00 DST
+	0x84, 0x89, 0x0b, 0x74,       //     2015-02-22 02:00Z -03:00
+	0xfc, 0xf5, 0x14, 0xf8,       //     2015-10-18 03:00Z -02:00 DST
+	0x84, 0x89, 0x0b, 0x74,       //     2016-02-21 02:00Z -03:00
+	0xfc, 0xf5, 0x14, 0xf8,       //     2016-10-16 03:00Z -02:00 DST
+	0x84, 0x89, 0x0b, 0x74,       //     2017-02-19 02:00Z -03:00
+	0xfc, 0xf5, 0x14, 0xf8,       //     2017-10-15 03:00Z -02:00 DST
+	0x84, 0x89, 0x0b, 0x74,       //     2018-02-18 02:00Z -03:00
+	0x9c, 0xe2, 0x16, 0xf8,       //     2018-11-04 03:00Z -02:00 DST
+	0xe4, 0x9c, 0x09, 0x74,       //     2019-02-17 02:00Z -03:00 rules
+	0x00, 0xf4,                   // FKST 2000-01-01 00:00Z -03:00 DST
+	0xf4, 0xa9, 0x09, 0x70,       //     2000-04-16 03:00Z -04:00
+	0x9c, 0xf6, 0x0c, 0xf4,       //     2000-09-10 04:00Z -03:00 DST
+	0xdc, 0x89, 0x13, 0x70,       //     2001-04-15 05:00Z -04:00
+	0xbc, 0xa7, 0x0c, 0xf4,       //     2001-09-02 06:00Z -03:00 DST
+	0xa4, 0xa6, 0x14, 0x70,       //     2002-04-21 05:00Z -04:00
+	0xdc, 0xd8, 0x0b, 0xf4,       //     2002-09-01 06:00Z -03:00 DST
+	0xa4, 0xa6, 0x14, 0x70,       //     2003-04-20 05:00Z -04:00
+	0xbc, 0xa7, 0x0c, 0xf4,       //     2003-09-07 06:00Z -03:00 DST
+	0xc4, 0xd7, 0x13, 0x70,       //     2004-04-18 05:00Z -04:00
+	0xbc, 0xa7, 0x0c, 0xf4,       //     2004-09-05 06:00Z -03:00 DST
+	0xc4, 0xd7, 0x13, 0x70,       //     2005-04-17 05:00Z -04:00
+	0xbc, 0xa7, 0x0c, 0xf4,       //     2005-09-04 06:00Z -03:00 DST
+	0xc4, 0xd7, 0x13, 0x70,       //     2006-04-16 05:00Z -04:00
+	0xbc, 0xa7, 0x0c, 0xf4,       //     2006-09-03 06:00Z -03:00 DST
+	0xc4, 0xd7, 0x13, 0x70,       //     2007-04-15 05:00Z -04:00
+	0xbc, 0xa7, 0x0c, 0xf4,       //     2007-09-02 06:00Z -03:00 DST
+	0xa4, 0xa6, 0x14, 0x70,       //     2008-04-20 05:00Z -04:00
+	0xbc, 0xa7, 0x0c, 0xf4,       //     2008-09-07 06:00Z -03:00 DST
+	0xc4, 0xd7, 0x13, 0x70,       //     2009-04-19 05:00Z -04:00
+	0xbc, 0xa7, 0x0c, 0xf4,       //     2009-09-06 06:00Z -03:00 DST
+	0xc4, 0xd7, 0x13, 0x70,       //     2010-04-18 05:00Z -04:00
+	0xbc, 0xa7, 0x0c, 0x74,       //     2010-09-05 06:00Z -03:00 rules
+	0x00, 0x74,                   // PMST 2000-01-01 00:00Z -03:00
+	0xac, 0x8d, 0x08, 0xf8,       //     2000-04-02 05:00Z -02:00 DST
+	0x84, 0xba, 0x12, 0x74,       //     2000-10-29 04:00Z -03:00
+	0xfc, 0xc4, 0x0d, 0xf8,       //     2001-04-01 05:00Z -02:00 DST
+	0x84, 0xba, 0x12, 0x74,       //     2001-10-28 04:00Z -03:00
+	0xdc, 0x93, 0x0e, 0xf8,       //     2002-04-07 05:00Z -02:00 DST
+	0xa4, 0xeb, 0x11, 0x74,       //     2002-10-27 04:00Z -03:00
+	0xdc, 0x93, 0x0e, 0xf8,       //     2003-04-06 05:00Z -02:00 DST
+	0xa4, 0xeb, 0x11, 0x74,       //     2003-10-26 04:00Z -03:00
+	0xdc, 0x93, 0x0e, 0xf8,       //     2004-04-04 05:00Z -02:00 DST
+	0x84, 0xba, 0x12, 0x74,       //     2004-10-31 04:00Z -03:00
+	0xfc, 0xc4, 0x0d, 0xf8,       //     2005-04-03 05:00Z -02:00 DST
+	0x84, 0xba, 0x12, 0x74,       //     2005-10-30 04:00Z -03:00
+	0xfc, 0xc4, 0x0d, 0xf8,       //     2006-04-02 05:00Z -02:00 DST
+	0x84, 0xba, 0x12, 0x74,       //     2006-10-29 04:00Z -03:00
+	0xdc, 0xd8, 0x0b, 0xf8,       //     2007-03-11 05:00Z -02:00 rules
+	0x00, 0x74,                   // UYT 2000-01-01 00:00Z -03:00
+	0x94, 0xb9, 0x97, 0x01, 0xf8, //     2004-09-19 03:00Z -02:00 DST
+	0xdc, 0xce, 0x10, 0x74,       //     2005-03-27 04:00Z -03:00
+	0xbc, 0x9d, 0x11, 0xf8,       //     2005-10-09 05:00Z -02:00 DST
+	0x84, 0xc4, 0x0d, 0x74,       //     2006-03-12 04:00Z -03:00
+	0x9c, 0xec, 0x11, 0xf8,       //     2006-10-01 05:00Z -02:00 DST
+	0xe4, 0x92, 0x0e, 0x74,       //     2007-03-11 04:00Z -03:00
+	0xfc, 0xba, 0x12, 0xf8,       //     2007-10-07 05:00Z -02:00 DST
+	0x84, 0xc4, 0x0d, 0x74,       //     2008-03-09 04:00Z -03:00
+	0xfc, 0xba, 0x12, 0xf8,       //     2008-10-05 05:00Z -02:00 DST
+	0x84, 0xc4, 0x0d, 0x74,       //     2009-03-08 04:00Z -03:00
+	0xfc, 0xba, 0x12, 0xf8,       //     2009-10-04 05:00Z -02:00 DST
+	0xe4, 0x92, 0x0e, 0x74,       //     2010-03-14 04:00Z -03:00
+	0x9c, 0xec, 0x11, 0xf8,       //     2010-10-03 05:00Z -02:00 DST
+	0xe4, 0x92, 0x0e, 0x74,       //     2011-03-13 04:00Z -03:00
+	0x9c, 0xec, 0x11, 0xf8,       //     2011-10-02 05:00Z -02:00 DST
+	0xe4, 0x92, 0x0e, 0x74,       //     2012-03-11 04:00Z -03:00
+	0xfc, 0xba, 0x12, 0xf8,       //     2012-10-07 05:00Z -02:00 DST
+	0x84, 0xc4, 0x0d, 0x74,       //     2013-03-10 04:00Z -03:00
+	0xfc, 0xba, 0x12, 0xf8,       //     2013-10-06 05:00Z -02:00 DST
+	0x84, 0xc4, 0x0d, 0x74,       //     2014-03-09 04:00Z -03:00
+	0xfc, 0xba, 0x12, 0xf8,       //     2014-10-05 05:00Z -02:00 DST
+	0x84, 0xc4, 0x0d, 0x74,       //     2015-03-08 04:00Z -03:00 rules
+	0x00, 0x72,                   // NT 2000-01-01 00:00Z -03:30
+	0xd3, 0x8c, 0x08, 0xf6,       //     2000-04-02 03:31Z -02:30 DST
+	0x84, 0xba, 0x12, 0x72,       //     2000-10-29 02:31Z -03:30
+	0xfc, 0xc4, 0x0d, 0xf6,       //     2001-04-01 03:31Z -02:30 DST
+	0x84, 0xba, 0x12, 0x72,       //     2001-10-28 02:31Z -03:30
+	0xdc, 0x93, 0x0e, 0xf6,       //     2002-04-07 03:31Z -02:30 DST
+	0xa4, 0xeb, 0x11, 0x72,       //     2002-10-27 02:31Z -03:30
+	0xdc, 0x93, 0x0e, 0xf6,       //     2003-04-06 03:31Z -02:30 DST
+	0xa4, 0xeb, 0x11, 0x72,       //     2003-10-26 02:31Z -03:30
+	0xdc, 0x93, 0x0e, 0xf6,       //     2004-04-04 03:31Z -02:30 DST
+	0x84, 0xba, 0x12, 0x72,       //     2004-10-31 02:31Z -03:30
+	0xfc, 0xc4, 0x0d, 0xf6,       //     2005-04-03 03:31Z -02:30 DST
+	0x84, 0xba, 0x12, 0x72,       //     2005-10-30 02:31Z -03:30
+	0xfc, 0xc4, 0x0d, 0xf6,       //     2006-04-02 03:31Z -02:30 DST
+	0x84, 0xba, 0x12, 0x72,       //     2006-10-29 02:31Z -03:30
+	0xdc, 0xd8, 0x0b, 0xf6,       //     2007-03-11 03:31Z -02:30 DST
+	0x84, 0xf5, 0x14, 0x72,       //     2007-11-04 02:31Z -03:30
+	0xfc, 0x89, 0x0b, 0xf6,       //     2008-03-09 03:31Z -02:30 DST
+	0x84, 0xf5, 0x14, 0x72,       //     2008-11-02 02:31Z -03:30
+	0xfc, 0x89, 0x0b, 0xf6,       //     2009-03-08 03:31Z -02:30 DST
+	0x84, 0xf5, 0x14, 0x72,       //     2009-11-01 02:31Z -03:30
+	0xdc, 0xd8, 0x0b, 0xf6,       //     2010-03-14 03:31Z -02:30 DST
+	0x84, 0xf5, 0x14, 0x72,       //     2010-11-07 02:31Z -03:30
+	0xfc, 0x89, 0x0b, 0xf6,       //     2011-03-13 03:31Z -02:30 DST
+	0xfb, 0xf5, 0x14, 0x72,       //     2011-11-06 04:30Z -03:30 rules
+	0x00, 0xf4,                   // CLT 2000-01-01 00:00Z -03:00 DST
+	0x94, 0xa0, 0x06, 0x70,       //     2000-03-12 03:00Z -04:00
+	0xdc, 0x89, 0x13, 0xf4,       //     2000-10-15 04:00Z -03:00 DST
+	0xa4, 0xf5, 0x0c, 0x70,       //     2001-03-11 03:00Z -04:00
+	0xdc, 0x89, 0x13, 0xf4,       //     2001-10-14 04:00Z -03:00 DST
+	0xa4, 0xf5, 0x0c, 0x70,       //     2002-03-10 03:00Z -04:00
+	0xdc, 0x89, 0x13, 0xf4,       //     2002-10-13 04:00Z -03:00 DST
+	0xa4, 0xf5, 0x0c, 0x70,       //     2003-03-09 03:00Z -04:00
+	0xdc, 0x89, 0x13, 0xf4,       //     2003-10-12 04:00Z -03:00 DST
+	0x84, 0xc4, 0x0d, 0x70,       //     2004-03-14 03:00Z -04:00
+	0xfc, 0xba, 0x12, 0xf4,       //     2004-10-10 04:00Z -03:00 DST
+	0x84, 0xc4, 0x0d, 0x70,       //     2005-03-13 03:00Z -04:00
+	0xfc, 0xba, 0x12, 0xf4,       //     2005-10-09 04:00Z -03:00 DST
+	0x84, 0xc4, 0x0d, 0x70,       //     2006-03-12 03:00Z -04:00
+	0xdc, 0x89, 0x13, 0xf4,       //     2006-10-15 04:00Z -03:00 DST
+	0xa4, 0xf5, 0x0c, 0x70,       //     2007-03-11 03:00Z -04:00
+	0xdc, 0x89, 0x13, 0xf4,       //     2007-10-14 04:00Z -03:00 DST
+	0xc4, 0xe1, 0x0e, 0x70,       //     2008-03-30 03:00Z -04:00
+	0xbc, 0x9d, 0x11, 0xf4,       //     2008-10-12 04:00Z -03:00 DST
+	0x84, 0xc4, 0x0d, 0x70,       //     2009-03-15 03:00Z -04:00
+	0xfc, 0xba, 0x12, 0xf4,       //     2009-10-11 04:00Z -03:00 DST
+	0xa4, 0xb0, 0x0f, 0x70,       //     2010-04-04 03:00Z -04:00
+	0xdc, 0xce, 0x10, 0xf4,       //     2010-10-10 04:00Z -03:00 DST
+	0x84, 0xba, 0x12, 0x70,       //     2011-05-08 03:00Z -04:00
+	0xdc, 0x9d, 0x09, 0xf4,       //     2011-08-21 04:00Z -03:00 DST
+	0xc4, 0x92, 0x16, 0x70,       //     2012-04-29 03:00Z -04:00
+	0xfc, 0x89, 0x0b, 0xf4,       //     2012-09-02 04:00Z -03:00 DST
+	0x84, 0xf5, 0x14, 0x70,       //     2013-04-28 03:00Z -04:00
+	0xdc, 0xd8, 0x0b, 0xf4,       //     2013-09-08 04:00Z -03:00 DST
+	0xa4, 0xa6, 0x14, 0x70,       //     2014-04-27 03:00Z -04:00
+	0xdc, 0xd8, 0x0b, 0xf4,       //     2014-09-07 04:00Z -03:00 DST
+	0xc4, 0x91, 0x36, 0x70,       //     2016-05-15 03:00Z -04:00
+	0x9c, 0x80, 0x08, 0xf4,       //     2016-08-14 04:00Z -03:00 DST
+	0xe4, 0xfe, 0x17, 0x70,       //     2017-05-14 03:00Z -04:00
+	0x9c, 0x80, 0x08, 0xf4,       //     2017-08-13 04:00Z -03:00 DST
+	0xe4, 0xfe, 0x17, 0x70,       //     2018-05-13 03:00Z -04:00
+	0x9c, 0x80, 0x08, 0xf4,       //     2018-08-12 04:00Z -03:00 DST
+	0x84, 0xf5, 0x14, 0x70,       //     2019-04-07 03:00Z -04:00
+	0xfc, 0xc4, 0x0d, 0xf4,       //     2019-09-08 04:00Z -03:00 DST
+	0x84, 0xba, 0x12, 0x70,       //     2020-04-05 03:00Z -04:00
+	0xfc, 0xc4, 0x0d, 0xf4,       //     2020-09-06 04:00Z -03:00 DST
+	0x84, 0xba, 0x12, 0x70,       //     2021-04-04 03:00Z -04:00
+	0xfc, 0xc4, 0x0d, 0xf4,       //     2021-09-05 04:00Z -03:00 DST
+	0x84, 0xba, 0x12, 0x70,       //     2022-04-03 03:00Z -04:00
+	0xdc, 0x93, 0x0e, 0xf4,       //     2022-09-11 04:00Z -03:00 rules
+	0x00, 0xf4,                   // PYT 2000-01-01 00:00Z -03:00 DST
+	0xb4, 0xd1, 0x05, 0x70,       //     2000-03-05 03:00Z -04:00
+	0xfc, 0xba, 0x12, 0xf4,       //     2000-10-01 04:00Z -03:00 DST
+	0x84, 0xc4, 0x0d, 0x70,       //     2001-03-04 03:00Z -04:00
+	0xdc, 0x89, 0x13, 0xf4,       //     2001-10-07 04:00Z -03:00 DST
+	0x84, 0xff, 0x0f, 0x70,       //     2002-04-07 03:00Z -04:00
+	0x9c, 0xf6, 0x0c, 0xf4,       //     2002-09-01 04:00Z -03:00 DST
+	0xe4, 0x88, 0x13, 0x70,       //     2003-04-06 03:00Z -04:00
+	0xfc, 0xc4, 0x0d, 0xf4,       //     2003-09-07 04:00Z -03:00 DST
+	0x84, 0xba, 0x12, 0x70,       //     2004-04-04 03:00Z -04:00
+	0xbc, 0x9d, 0x11, 0xf4,       //     2004-10-17 04:00Z -03:00 DST
+	0xa4, 0xf5, 0x0c, 0x70,       //     2005-03-13 03:00Z -04:00
+	0xdc, 0x89, 0x13, 0xf4,       //     2005-10-16 04:00Z -03:00 DST
+	0xa4, 0xf5, 0x0c, 0x70,       //     2006-03-12 03:00Z -04:00
+	0xdc, 0x89, 0x13, 0xf4,       //     2006-10-15 04:00Z -03:00 DST
+	0xa4, 0xf5, 0x0c, 0x70,       //     2007-03-11 03:00Z -04:00
+	0xbc, 0xd8, 0x13, 0xf4,       //     2007-10-21 04:00Z -03:00 DST
+	0xc4, 0xa6, 0x0c, 0x70,       //     2008-03-09 03:00Z -04:00
+	0xbc, 0xd8, 0x13, 0xf4,       //     2008-10-19 04:00Z -03:00 DST
+	0xc4, 0xa6, 0x0c, 0x70,       //     2009-03-08 03:00Z -04:00
+	0xbc, 0xd8, 0x13, 0xf4,       //     2009-10-18 04:00Z -03:00 DST
+	0xa4, 0xb0, 0x0f, 0x70,       //     2010-04-11 03:00Z -04:00
+	0x9c, 0xb1, 0x0f, 0xf4,       //     2010-10-03 04:00Z -03:00 DST
+	0xe4, 0xcd, 0x10, 0x70,       //     2011-04-10 03:00Z -04:00
+	0x9c, 0xb1, 0x0f, 0xf4,       //     2011-10-02 04:00Z -03:00 DST
+	0xe4, 0xcd, 0x10, 0x70,       //     2012-04-08 03:00Z -04:00
+	0xfc, 0xff, 0x0f, 0xf4,       //     2012-10-07 04:00Z -03:00 DST
+	0xc4, 0xe1, 0x0e, 0x70,       //     2013-03-24 03:00Z -04:00
+	0xbc, 0x9d, 0x11, 0xf4,       //     2013-10-06 04:00Z -03:00 DST
+	0xc4, 0xe1, 0x0e, 0x70,       //     2014-03-23 03:00Z -04:00
+	0xbc, 0x9d, 0x11, 0xf4,       //     2014-10-05 04:00Z -03:00 DST
+	0xc4, 0xe1, 0x0e, 0x70,       //     2015-03-22 03:00Z -04:00
+	0xbc, 0x9d, 0x11, 0xf4,       //     2015-10-04 04:00Z -03:00 DST
+	0xa4, 0xb0, 0x0f, 0x70,       //     2016-03-27 03:00Z -04:00
+	0xdc, 0xce, 0x10, 0xf4,       //     2016-10-02 04:00Z -03:00 DST
+	0xa4, 0xb0, 0x0f, 0x70,       //     2017-03-26 03:00Z -04:00
+	0xdc, 0xce, 0x10, 0xf4,       //     2017-10-01 04:00Z -03:00 DST
+	0xa4, 0xb0, 0x0f, 0x70,       //     2018-03-25 03:00Z -04:00
+	0xbc, 0x9d, 0x11, 0xf4,       //     2018-10-07 04:00Z -03:00 DST
+	0xc4, 0xe1, 0x0e, 0x70,       //     2019-03-24 03:00Z -04:00
+	0xbc, 0x9d, 0x11, 0xf4,       //     2019-10-06 04:00Z -03:00 DST
+	0xc4, 0xe1, 0x0e, 0x70,       //     2020-03-22 03:00Z -04:00
+	0xbc, 0x9d, 0x11, 0xf4,       //     2020-10-04 04:00Z -03:00 DST
+	0xa4, 0xb0, 0x0f, 0x70,       //     2021-03-28 03:00Z -04:00
+	0xdc, 0xce, 0x10, 0xf4,       //     2021-10-03 04:00Z -03:00 DST
+	0xa4, 0xb0, 0x0f, 0x70,       //     2022-03-27 03:00Z -04:00
+	0xdc, 0xce, 0x10, 0xf4,       //     2022-10-02 04:00Z -03:00 DST
+	0xa4, 0xb0, 0x0f, 0x70,       //     2023-03-26 03:00Z -04:00
+	0xdc, 0xce, 0x10, 0xf4,       //     2023-10-01 04:00Z -03:00 DST
+	0xa4, 0xb0, 0x0f, 0x70,       //     2024-03-24 03:00Z -04:00
+	0xbc, 0x9d, 0x11, 0xf4,       //     2024-10-06 04:00Z -03:00 DST
+	0xe4, 0x64, 0x74,             //     2024-10-15 03:00Z -03:00 rules
+	0x00, 0x70,                   // VET 2000-01-01 00:00Z -04:00
+	0x84, 0xe9, 0xfe, 0x01, 0x6e, //     2007-12-09 07:00Z -04:30
+	0xc0, 0xbc, 0x8d, 0x02, 0x70, //     2016-05-01 07:00Z -04:00 rules
+	0x00, 0x6c,                   // CUST 2000-01-01 00:00Z -05:00
+	0xac, 0x8d, 0x08, 0xf0,       //     2000-04-02 05:00Z -04:00 DST
+	0xc0, 0xba, 0x12, 0x6c,       //     2000-10-29 05:00Z -05:00
+	0xc0, 0xc4, 0x0d, 0xf0,       //     2001-04-01 05:00Z -04:00 DST
+	0xc0, 0xba, 0x12, 0x6c,       //     2001-10-28 05:00Z -05:00
+	0xa0, 0x93, 0x0e, 0xf0,       //     2002-04-07 05:00Z -04:00 DST
+	0xe0, 0xeb, 0x11, 0x6c,       //     2002-10-27 05:00Z -05:00
+	0xa0, 0x93, 0x0e, 0xf0,       //     2003-04-06 05:00Z -04:00 DST
+	0xe0, 0xeb, 0x11, 0x6c,       //     2003-10-26 05:00Z -05:00
+	0xc0, 0xc4, 0x0d, 0xf0,       //     2004-03-28 05:00Z -04:00 DST
+	0xa0, 0x87, 0x53, 0x6c,       //     2006-10-29 05:00Z -05:00
+	0xa0, 0xd8, 0x0b, 0xf0,       //     2007-03-11 05:00Z -04:00 DST
+	0xe0, 0xa6, 0x14, 0x6c,       //     2007-10-28 05:00Z -05:00
+	0x80, 0xa7, 0x0c, 0xf0,       //     2008-03-16 05:00Z -04:00 DST
+	0x80, 0xd8, 0x13, 0x6c,       //     2008-10-26 05:00Z -05:00
+	0xa0, 0xd8, 0x0b, 0xf0,       //     2009-03-08 05:00Z -04:00 DST
+	0xe0, 0xa6, 0x14, 0x6c,       //     2009-10-25 05:00Z -05:00
+	0x80, 0xa7, 0x0c, 0xf0,       //     2010-03-14 05:00Z -04:00 DST
+	0xe0, 0xa6, 0x14, 0x6c,       //     2010-10-31 05:00Z -05:00
+	0x80, 0xa7, 0x0c, 0xf0,       //     2011-03-20 05:00Z -04:00 DST
+	0xc0, 0xf5, 0x14, 0x6c,       //     2011-11-13 05:00Z -05:00
+	0x80, 0xa7, 0x0c, 0xf0,       //     2012-04-01 05:00Z -04:00 rules
+	0x00, 0x6c,                   // EST 2000-01-01 00:00Z -05:00
+	0xa4, 0x8e, 0x08, 0xf0,       //     2000-04-02 07:00Z -04:00 DST
+	0x84, 0xba, 0x12, 0x6c,       //     2000-10-29 06:00Z -05:00
+	0xfc, 0xc4, 0x0d, 0xf0,       //     2001-04-01 07:00Z -04:00 DST
+	0x84, 0xba, 0x12, 0x6c,       //     2001-10-28 06:00Z -05:00
+	0xdc, 0x93, 0x0e, 0xf0,       //     2002-04-07 07:00Z -04:00 DST
+	0xa4, 0xeb, 0x11, 0x6c,       //     2002-10-27 06:00Z -05:00
+	0xdc, 0x93, 0x0e, 0xf0,       //     2003-04-06 07:00Z -04:00 DST
+	0xa4, 0xeb, 0x11, 0x6c,       //     2003-10-26 06:00Z -05:00
+	0xdc, 0x93, 0x0e, 0xf0,       //     2004-04-04 07:00Z -04:00 DST
+	0x84, 0xba, 0x12, 0x6c,       //     2004-10-31 06:00Z -05:00
+	0xfc, 0xc4, 0x0d, 0xf0,       //     2005-04-03 07:00Z -04:00 DST
+	0x84, 0xba, 0x12, 0x6c,       //     2005-10-30 06:00Z -05:00
+	0xfc, 0xc4, 0x0d, 0xf0,       //     2006-04-02 07:00Z -04:00 DST
+	0x84, 0xba, 0x12, 0x6c,       //     2006-10-29 06:00Z -05:00
+	0xdc, 0xd8, 0x0b, 0xf0,       //     2007-03-11 07:00Z -04:00 rules
+	0x00, 0x68,                   // CST 2000-01-01 00:00Z -06:00
+	0xe0, 0x8e, 0x08, 0xec,       //     2000-04-02 08:00Z -05:00 DST
+	0x84, 0xba, 0x12, 0x68,       //     2000-10-29 07:00Z -06:00
+	0xfc, 0xc4, 0x0d, 0xec,       //     2001-04-01 08:00Z -05:00 DST
+	0x84, 0xba, 0x12, 0x68,       //     2001-10-28 07:00Z -06:00
+	0xdc, 0x93, 0x0e, 0xec,       //     2002-04-07 08:00Z -05:00 DST
+	0xa4, 0xeb, 0x11, 0x68,       //     2002-10-27 07:00Z -06:00
+	0xdc, 0x93, 0x0e, 0xec,       //     2003-04-06 08:00Z -05:00 DST
+	0xa4, 0xeb, 0x11, 0x68,       //     2003-10-26 07:00Z -06:00
+	0xdc, 0x93, 0x0e, 0xec,       //     2004-04-04 08:00Z -05:00 DST
+	0x84, 0xba, 0x12, 0x68,       //     2004-10-31 07:00Z -06:00
+	0xfc, 0xc4, 0x0d, 0xec,       //     2005-04-03 08:00Z -05:00 DST
+	0x84, 0xba, 0x12, 0x68,       //     2005-10-30 07:00Z -06:00
+	0xfc, 0xc4, 0x0d, 0xec,       //     2006-04-02 08:00Z -05:00 DST
+	0x84, 0xba, 0x12, 0x68,       //     2006-10-29 07:00Z -06:00
+	0xdc, 0xd8, 0x0b, 0xec,       //     2007-03-11 08:00Z -05:00 rules
+	0x00, 0xec,                   // EAST 2000-01-01 00:00Z -05:00 DST
+	0x94, 0xa0, 0x06, 0x68,       //     2000-03-12 03:00Z -06:00
+	0xdc, 0x89, 0x13, 0xec,       //     2000-10-15 04:00Z -05:00 DST
+	0xa4, 0xf5, 0x0c, 0x68,       //     2001-03-11 03:00Z -06:00
+	0xdc, 0x89, 0x13, 0xec,       //     2001-10-14 04:00Z -05:00 DST
+	0xa4, 0xf5, 0x0c, 0x68,       //     2002-03-10 03:00Z -06:00
+	0xdc, 0x89, 0x13, 0xec,       //     2002-10-13 04:00Z -05:00 DST
+	0xa4, 0xf5, 0x0c, 0x68,       //     2003-03-09 03:00Z -06:00
+	0xdc, 0x89, 0x13, 0xec,       //     2003-10-12 04:00Z -05:00 DST
+	0x84, 0xc4, 0x0d, 0x68,       //     2004-03-14 03:00Z -06:00
+	0xfc, 0xba, 0x12, 0xec,       //     2004-10-10 04:00Z -05:00 DST
+	0x84, 0xc4, 0x0d, 0x68,       //     2005-03-13 03:00Z -06:00
+	0xfc, 0xba, 0x12, 0xec,       //     2005-10-09 04:00Z -05:00 DST
+	0x84, 0xc4, 0x0d, 0x68,       //     2006-03-12 03:00Z -06:00
+	0xdc, 0x89, 0x13, 0xec,       //     2006-10-15 04:00Z -05:00 DST
+	0xa4, 0xf5, 0x0c, 0x68,       //     2007-03-11 03:00Z -06:00
+	0xdc, 0x89, 0x13, 0xec,       //     2007-10-14 04:00Z -05:00 DST
+	0xc4, 0xe1, 0x0e, 0x68,       //     2008-03-30 03:00Z -06:00
+	0xbc, 0x9d, 0x11, 0xec,       //     2008-10-12 04:00Z -05:00 DST
+	0x84, 0xc4, 0x0d, 0x68,       //     2009-03-15 03:00Z -06:00
+	0xfc, 0xba, 0x12, 0xec,       //     2009-10-11 04:00Z -05:00 DST
+	0xa4, 0xb0, 0x0f, 0x68,       //     2010-04-04 03:00Z -06:00
+	0xdc, 0xce, 0x10, 0xec,       //     2010-10-10 04:00Z -05:00 DST
+	0x84, 0xba, 0x12, 0x68,       //     2011-05-08 03:00Z -06:00
+	0xdc, 0x9d, 0x09, 0xec,       //     2011-08-21 04:00Z -05:00 DST
+	0xc4, 0x92, 0x16, 0x68,       //     2012-04-29 03:00Z -06:00
+	0xfc, 0x89, 0x0b, 0xec,       //     2012-09-02 04:00Z -05:00 DST
+	0x84, 0xf5, 0x14, 0x68,       //     2013-04-28 03:00Z -06:00
+	0xdc, 0xd8, 0x0b, 0xec,       //     2013-09-08 04:00Z -05:00 DST
+	0xa4, 0xa6, 0x14, 0x68,       //     2014-04-27 03:00Z -06:00
+	0xdc, 0xd8, 0x0b, 0xec,       //     2014-09-07 04:00Z -05:00 DST
+	0xc4, 0x91, 0x36, 0x68,       //     2016-05-15 03:00Z -06:00
+	0x9c, 0x80, 0x08, 0xec,       //     2016-08-14 04:00Z -05:00 DST
+	0xe4, 0xfe, 0x17, 0x68,       //     2017-05-14 03:00Z -06:00
+	0x9c, 0x80, 0x08, 0xec,       //     2017-08-13 04:00Z -05:00 DST
+	0xe4, 0xfe, 0x17, 0x68,       //     2018-05-13 03:00Z -06:00
+	0x9c, 0x80, 0x08, 0xec,       //     2018-08-12 04:00Z -05:00 DST
+	0x84, 0xf5, 0x14, 0x68,       //     2019-04-07 03:00Z -06:00
+	0xfc, 0xc4, 0x0d, 0xec,       //     2019-09-08 04:00Z -05:00 DST
+	0x84, 0xba, 0x12, 0x68,       //     2020-04-05 03:00Z -06:00
+	0xfc, 0xc4, 0x0d, 0xec,       //     2020-09-06 04:00Z -05:00 DST
+	0x84, 0xba, 0x12, 0x68,       //     2021-04-04 03:00Z -06:00
+	0xfc, 0xc4, 0x0d, 0xec,       //     2021-09-05 04:00Z -05:00 DST
+	0x84, 0xba, 0x12, 0x68,       //     2022-04-03 03:00Z -06:00
+	0xdc, 0x93, 0x0e, 0xec,       //     2022-09-11 04:00Z -05:00 rules
+	0x00, 0x64,                   // MST 2000-01-01 00:00Z -07:00
+	0x9c, 0x8f, 0x08, 0xe8,       //     2000-04-02 09:00Z -06:00 DST
+	0x84, 0xba, 0x12, 0x64,       //     2000-10-29 08:00Z -07:00
+	0xfc, 0xc4, 0x0d, 0xe8,       //     2001-04-01 09:00Z -06:00 DST
+	0x84, 0xba, 0x12, 0x64,       //     2001-10-28 08:00Z -07:00
+	0xdc, 0x93, 0x0e, 0xe8,       //     2002-04-07 09:00Z -06:00 DST
+	0xa4, 0xeb, 0x11, 0x64,       //     2002-10-27 08:00Z -07:00
+	0xdc, 0x93, 0x0e, 0xe8,       //     2003-04-06 09:00Z -06:00 DST
+	0xa4, 0xeb, 0x11, 0x64,       //     2003-10-26 08:00Z -07:00
+	0xdc, 0x93, 0x0e, 0xe8,       //     2004-04-04 09:00Z -06:00 DST
+	0x84, 0xba, 0x12, 0x64,       //     2004-10-31 08:00Z -07:00
+	0xfc, 0xc4, 0x0d, 0xe8,       //     2005-04-03 09:00Z -06:00 DST
+	0x84, 0xba, 0x12, 0x64,       //     2005-10-30 08:00Z -07:00
+	0xfc, 0xc4, 0x0d, 0xe8,       //     2006-04-02 09:00Z -06:00 DST
+	0x84, 0xba, 0x12, 0x64,       //     2006-10-29 08:00Z -07:00
+	0xdc, 0xd8, 0x0b, 0xe8,       //     2007-03-11 09:00Z -06:00 rules
+	0x00, 0x60,                   // PST 2000-01-01 00:00Z -08:00
+	0xd8, 0x8f, 0x08, 0xe4,       //     2000-04-02 10:00Z -07:00 DST
+	0x84, 0xba, 0x12, 0x60,       //     2000-10-29 09:00Z -08:00
+	0xfc, 0xc4, 0x0d, 0xe4,       //     2001-04-01 10:00Z -07:00 DST
+	0x84, 0xba, 0x12, 0x60,       //     2001-10-28 09:00Z -08:00
+	0xdc, 0x93, 0x0e, 0xe4,       //     2002-04-07 10:00Z -07:00 DST
+	0xa4, 0xeb, 0x11, 0x60,       //     2002-10-27 09:00Z -08:00
+	0xdc, 0x93, 0x0e, 0xe4,       //     2003-04-06 10:00Z -07:00 DST
+	0xa4, 0xeb, 0x11, 0x60,       //     2003-10-26 09:00Z -08:00
+	0xdc, 0x93, 0x0e, 0xe4,       //     2004-04-04 10:00Z -07:00 DST
+	0x84, 0xba, 0x12, 0x60,       //     2004-10-31 09:00Z -08:00
+	0xfc, 0xc4, 0x0d, 0xe4,       //     2005-04-03 10:00Z -07:00 DST
+	0x84, 0xba, 0x12, 0x60,       //     2005-10-30 09:00Z -08:00
+	0xfc, 0xc4, 0x0d, 0xe4,       //     2006-04-02 10:00Z -07:00 DST
+	0x84, 0xba, 0x12, 0x60,       //     2006-10-29 09:00Z -08:00
+	0xdc, 0xd8, 0x0b, 0xe4,       //     2007-03-11 10:00Z -07:00 rules
+	0x00, 0x5c,                   // AKST 2000-01-01 00:00Z -09:00
+	0x94, 0x90, 0x08, 0xe0,       //     2000-04-02 11:00Z -08:00 DST
+	0x84, 0xba, 0x12, 0x5c,       //     2000-10-29 10:00Z -09:00
+	0xfc, 0xc4, 0x0d, 0xe0,       //     2001-04-01 11:00Z -08:00 DST
+	0x84, 0xba, 0x12, 0x5c,       //     2001-10-28 10:00Z -09:00
+	0xdc, 0x93, 0x0e, 0xe0,       //     2002-04-07 11:00Z -08:00 DST
+	0xa4, 0xeb, 0x11, 0x5c,       //     2002-10-27 10:00Z -09:00
+	0xdc, 0x93, 0x0e, 0xe0,       //     2003-04-06 11:00Z -08:00 DST
+	0xa4, 0xeb, 0x11, 0x5c,       //     2003-10-26 10:00Z -09:00
+	0xdc, 0x93, 0x0e, 0xe0,       //     2004-04-04 11:00Z -08:00 DST
+	0x84, 0xba, 0x12, 0x5c,       //     2004-10-31 10:00Z -09:00
+	0xfc, 0xc4, 0x0d, 0xe0,       //     2005-04-03 11:00Z -08:00 DST
+	0x84, 0xba, 0x12, 0x5c,       //     2005-10-30 10:00Z -09:00
+	0xfc, 0xc4, 0x0d, 0xe0,       //     2006-04-02 11:00Z -08:00 DST
+	0x84, 0xba, 0x12, 0x5c,       //     2006-10-29 10:00Z -09:00
+	0xdc, 0xd8, 0x0b, 0xe0,       //     2007-03-11 11:00Z -08:00 rules
+	0x00, 0x58,                   // HAST 2000-01-01 00:00Z -10:00
+	0xd0, 0x90, 0x08, 0xdc,       //     2000-04-02 12:00Z -09:00 DST
+	0x84, 0xba, 0x12, 0x58,       //     2000-10-29 11:00Z -10:00
+	0xfc, 0xc4, 0x0d, 0xdc,       //     2001-04-01 12:00Z -09:00 DST
+	0x84, 0xba, 0x12, 0x58,       //     2001-10-28 11:00Z -10:00
+	0xdc, 0x93, 0x0e, 0xdc,       //     2002-04-07 12:00Z -09:00 DST
+	0xa4, 0xeb, 0x11, 0x58,       //     2002-10-27 11:00Z -10:00
+	0xdc, 0x93, 0x0e, 0xdc,       //     2003-04-06 12:00Z -09:00 DST
+	0xa4, 0xeb, 0x11, 0x58,       //     2003-10-26 11:00Z -10:00
+	0xdc, 0x93, 0x0e, 0xdc,       //     2004-04-04 12:00Z -09:00 DST
+	0x84, 0xba, 0x12, 0x58,       //     2004-10-31 11:00Z -10:00
+	0xfc, 0xc4, 0x0d, 0xdc,       //     2005-04-03 12:00Z -09:00 DST
+	0x84, 0xba, 0x12, 0x58,       //     2005-10-30 11:00Z -10:00
+	0xfc, 0xc4, 0x0d, 0xdc,       //     2006-04-02 12:00Z -09:00 DST
+	0x84, 0xba, 0x12, 0x58,       //     2006-10-29 11:00Z -10:00
+	0xdc, 0xd8, 0x0b, 0xdc,       //     2007-03-11 12:00Z -09:00 rules
+	0 };		// 4817 bytes
+
+// offset of each zone's first record in TZ_TRANS, and of the end
+const unsigned int TZ_TRANS_AT[] PROGMEM = {
+	0,	// UTC
+	0,	// WET
+	0,	// CET
+	0,	// IRLT
+	0,	// WAT
+	0,	// CAT
+	0,	// EET
+	0,	// IST
+	110,	// SAST
+	110,	// USZ1
+	208,	// ARST
+	208,	// EAT
+	208,	// FET
+	302,	// IOT
+	302,	// MSK
+	400,	// SYOT
+	400,	// IRST
+	570,	// AMT
+	668,	// AZT
+	798,	// GET
+	848,	// GST
+	848,	// MUT
+	859,	// RET
+	859,	// SAMT
+	953,	// SCT
+	953,	// VOLT
+	1060,	// AFT
+	1060,	// HMT
+	1060,	// MAWT
+	1067,	// MVT
+	1067,	// ORAT
+	1109,	// PKT
+	1136,	// TFT
+	1136,	// TJT
+	1136,	// TMT
+	1136,	// UZT
+	1136,	// YEKT
+	1234,	// INST
+	1234,	// SLST
+	1241,	// NPT
+	1241,	// BIOT
+	1241,	// BST
+	1252,	// BTT
+	1252,	// KGT
+	1302,	// OMST
+	1400,	// VOST
+	1407,	// CCT
+	1407,	// MMT
+	1407,	// CXT
+	1407,	// DAVT
+	1426,	// HOVT
+	1493,	// ICT
+	1493,	// KRAT
+	1591,	// THA
+	1591,	// WIT
+	1591,	// ACT
+	1591,	// AWST
+	1618,	// BDT
+	1618,	// CHOT
+	1685,	// CIT
+	1685,	// CT
+	1685,	// HKT
+	1685,	// IRKT
+	1783,	// MYT
+	1783,	// PHST
+	1783,	// SGT
+	1783,	// ULAT
+	1850,	// WST
+	1877,	// EIT
+	1877,	// JST
+	1877,	// KST
+	1877,	// TLT
+	1883,	// YAKT
+	1981,	// ACST
+	2047,	// AEST
+	2113,	// ChST
+	2113,	// CHUT
+	2113,	// DDUT
+	2113,	// PGT
+	2113,	// VLAT
+	2211,	// LHST
+	2277,	// KOST
+	2277,	// MIST
+	2363,	// NCT
+	2363,	// PONT
+	2363,	// SAKT
+	2465,	// SBT
+	2465,	// SRET
+	2563,	// VUT
+	2563,	// NFT
+	2575,	// FJT
+	2678,	// GILT
+	2678,	// MAGT
+	2780,	// MHT
+	2780,	// NZST
+	2846,	// PETT
+	2940,	// TVT
+	2940,	// WAKT
+	2940,	// CHAST
+	3006,	// PHOT
+	3006,	// TKT
+	3013,	// TOT
+	3044,	// LINT
+	3044,	// AZOST
+	3044,	// CVT
+	3044,	// EGT
+	3242,	// FNT
+	3263,	// SGST
+	3263,	// ART
+	3286,	// BRT
+	3444,	// FKST
+	3534,	// GFT
+	3534,	// PMST
+	3596,	// ROTT
+	3596,	// SRT
+	3596,	// UYT
+	3687,	// NT
+	3785,	// AMZT
+	3785,	// AST
+	3785,	// BOT
+	3785,	// CLT
+	3963,	// COST
+	3963,	// ECT
+	3963,	// FKT
+	3963,	// GYT
+	3963,	// PYT
+	4168,	// VET
+	4180,	// COT
+	4180,	// CUST
+	4266,	// ECUT
+	4266,	// EST
+	4328,	// PET
+	4328,	// CST
+	4390,	// EAST
+	4568,	// GALT
+	4568,	// MST
+	4630,	// CIST
+	4630,	// PST
+	4692,	// AKST
+	4754,	// GIT
+	4754,	// MART
+	4754,	// CKT
+	4754,	// HAST
+	4816,	// HST
+	4816,	// TAHT
+	4816,	// NUT
+	4816,	// SST
+	4816,	// BIT
+	4816 };	// end
+
 // the first entry in each DS_* table represent impossible values to ensure DS_NONE has no effect.
-const int DS_SMON[] = {
+constexpr byte DS_SMON[] PROGMEM = {
 	99,	// NONE
-	9,		// AFRICA
+	4,	// EUROPE_WET
+	4,	// EUROPE_CET
+	4,	// EUROPE_EET
+	3,	// ISRAEL
 	10,	// AUSTRALIA
-	4,		// EUROPE
-	11,	// FIJI
-	3,		// IRAN
-	4,		// ISRAEL
-	3,		// NAMERICA
 	10,	// NZEALAND
-	10,	// PARAGUAY
-	10	};	// URUGUAY
+	10,	// CHATHAM
+	4,	// AZORES
+	4,	// GREENLAND
+	3,	// NAMERICA
+	9,	// CHILE
+	3,	// CUBA
+	9 };	// EASTER
 
-const int DS_SWEEK[] = {
+constexpr byte DS_SWEEK[] PROGMEM = {
 	99,	// NONE
-	1,		// AFRICA
-	1,		// AUSTRALIA
-	0,	// EUROPE
-	1,		// FIJI
-	0,		// IRAN
-	0,	// ISRAEL
-	2,		// NAMERICA
+	0,	// EUROPE_WET
+	0,	// EUROPE_CET
+	0,	// EUROPE_EET
+	4,	// ISRAEL
+	1,	// AUSTRALIA
 	0,	// NZEALAND
-	1,		// PARAGUAY
-	1	};	// URUGUAY
+	0,	// CHATHAM
+	0,	// AZORES
+	0,	// GREENLAND
+	2,	// NAMERICA
+	1,	// CHILE
+	2,	// CUBA
+	1 };	// EASTER
 
-const int DS_SDOW[] = {
+constexpr byte DS_SDOW[] PROGMEM = {
 	99,	// NONE
-	0,		// AFRICA
-	0,		// AUSTRALIA
-	0,		// EUROPE
-	0,		// FIJI
-	0,		// IRAN
-	5,		// ISRAEL
-	0,		// NAMERICA
-	0,		// NZEALAND
-	0,		// PARAGUAY
-	0	};	// URUGUAY
+	0,	// EUROPE_WET
+	0,	// EUROPE_CET
+	0,	// EUROPE_EET
+	4,	// ISRAEL
+	0,	// AUSTRALIA
+	0,	// NZEALAND
+	0,	// CHATHAM
+	0,	// AZORES
+	0,	// GREENLAND
+	0,	// NAMERICA
+	6,	// CHILE
+	0,	// CUBA
+	6 };	// EASTER
 
-const int DS_FMON[] = {
+constexpr byte DS_FMON[] PROGMEM = {
 	99,	// NONE
-	4,		// AFRICA
-	4,		// AUSTRALIA
-	11,	// EUROPE
-	1,		// FIJI
-	9,		// IRAN
+	11,	// EUROPE_WET
+	11,	// EUROPE_CET
+	11,	// EUROPE_EET
 	11,	// ISRAEL
+	4,	// AUSTRALIA
+	4,	// NZEALAND
+	4,	// CHATHAM
+	11,	// AZORES
+	11,	// GREENLAND
 	11,	// NAMERICA
-	4,		// NZEALAND
-	3,		// PARAGUAY
-	3,	};	// URUGUAY
+	4,	// CHILE
+	11,	// CUBA
+	4 };	// EASTER
 
-const int DS_FWEEK[] = {
+constexpr byte DS_FWEEK[] PROGMEM = {
 	99,	// NONE
-	1,		// AFRICA
-	1,		// AUSTRALIA
-	0,		// EUROPE
-	3,		// FIJI
-	0,		// IRAN
-	0,		// ISRAEL
-	1,		// NAMERICA
-	1,		// NZEALAND
-	4,		// PARAGUAY
-	2,	};	// URUGUAY
+	0,	// EUROPE_WET
+	0,	// EUROPE_CET
+	0,	// EUROPE_EET
+	0,	// ISRAEL
+	1,	// AUSTRALIA
+	1,	// NZEALAND
+	1,	// CHATHAM
+	0,	// AZORES
+	0,	// GREENLAND
+	1,	// NAMERICA
+	1,	// CHILE
+	1,	// CUBA
+	1 };	// EASTER
 
-const int DS_FDOW[] = {
+constexpr byte DS_FDOW[] PROGMEM = {
 	99,	// NONE
-	0,		// AFRICA
-	0,		// AUSTRALIA
-	0,		// EUROPE
-	0,		// FIJI
-	0,		// IRAN
-	0,		// ISRAEL
-	0,		// NAMERICA
-	0,		// NZEALAND
-	0,		// PARAGUAY
-	0,	};	// URUGUAY
+	0,	// EUROPE_WET
+	0,	// EUROPE_CET
+	0,	// EUROPE_EET
+	0,	// ISRAEL
+	0,	// AUSTRALIA
+	0,	// NZEALAND
+	0,	// CHATHAM
+	0,	// AZORES
+	0,	// GREENLAND
+	0,	// NAMERICA
+	6,	// CHILE
+	0,	// CUBA
+	6 };	// EASTER
 
 // if day != 0, override week/day-of-week calculation
-const int DS_SDAY[] = {
-	0,		// NONE
-	0,		// AFRICA
-	0,		// AUSTRALIA
-	0,		// EUROPE
-	0,		// FIJI
-	22,	// IRAN
-	0,		// ISRAEL
-	0,		// NAMERICA
-	0,		// NZEALAND
-	0,		// PARAGUAY
-	0	};	// URUGUAY
+constexpr byte DS_SDAY[] PROGMEM = {
+	0,	// NONE
+	0,	// EUROPE_WET
+	0,	// EUROPE_CET
+	0,	// EUROPE_EET
+	0,	// ISRAEL
+	0,	// AUSTRALIA
+	0,	// NZEALAND
+	0,	// CHATHAM
+	0,	// AZORES
+	0,	// GREENLAND
+	0,	// NAMERICA
+	0,	// CHILE
+	0,	// CUBA
+	0 };	// EASTER
+
+constexpr byte DS_FDAY[] PROGMEM = {
+	0,	// NONE
+	0,	// EUROPE_WET
+	0,	// EUROPE_CET
+	0,	// EUROPE_EET
+	0,	// ISRAEL
+	0,	// AUSTRALIA
+	0,	// NZEALAND
+	0,	// CHATHAM
+	0,	// AZORES
+	0,	// GREENLAND
+	0,	// NAMERICA
+	0,	// CHILE
+	0,	// CUBA
+	0 };	// EASTER
 
-const int DS_FDAY[] = {
-	0,		// NONE
-	0,		// AFRICA
-	0,		// AUSTRALIA
-	0,		// EUROPE
-	0,		// FIJI
-	22,	// IRAN
-	0,		// ISRAEL
-	0,		// NAMERICA
-	0,		// NZEALAND
-	0,		// PARAGUAY
-	0	};	// URUGUAY
+// transition times, in minutes past midnight local standard time
+constexpr int DS_STIME[] PROGMEM = {
+	0,	// NONE
+	60,	// EUROPE_WET
+	120,	// EUROPE_CET
+	180,	// EUROPE_EET
+	1560,	// ISRAEL
+	120,	// AUSTRALIA
+	120,	// NZEALAND
+	165,	// CHATHAM
+	0,	// AZORES
+	-60,	// GREENLAND
+	120,	// NAMERICA
+	1440,	// CHILE
+	0,	// CUBA
+	1320 };	// EASTER
 
+constexpr int DS_FTIME[] PROGMEM = {
+	0,	// NONE
+	60,	// EUROPE_WET
+	120,	// EUROPE_CET
+	180,	// EUROPE_EET
+	60,	// ISRAEL
+	120,	// AUSTRALIA
+	120,	// NZEALAND
+	165,	// CHATHAM
+	0,	// AZORES
+	-60,	// GREENLAND
+	60,	// NAMERICA
+	1380,	// CHILE
+	0,	// CUBA
+	1260 };	// EASTER
@@ -0,0 +1,505 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * tzbuild generates timezones.h in one pass over tz.data (abbreviations and
+ * names) and zones.data (the zoneinfo zone behind each entry). Offsets and DST
+ * rules come from the POSIX TZ footer of each compiled zoneinfo file, so they
+ * reflect the rules in force today. Identical rules are shared as one DS_*
+ * ruleset, named by the optional third column of zones.data.
+ *
+ * usage: tzbuild [-d zoneinfo-dir] [-t tz.data] [-z zones.data] > ../timezones.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "tzif.h"
+
+// a DST ruleset as the firmware stores it: week 0 is the last matching day of the
+// previous month, a non-zero day overrides week/day-of-week, and times are minutes
+// past midnight in local standard time
+struct ruleset {
+	std::string name;
+	int smon, sweek, sdow, sday, stime;
+	int fmon, fweek, fdow, fday, ftime;
+};
+
+// one state of a zone's history: from minutes (UTC, since the epoch) on, the zone
+// is offset seconds east of UTC, in DST or not
+struct transition {
+	long minutes;
+	int32_t offset;
+	bool dst;
+};
+
+struct zoneEntry {
+	std::string abbr, name, zone;
+	int hour, minute;
+	int ds;
+	std::string note;
+	std::vector<transition> history;	// up to and including where today's rules take over
+};
+
+static const char* MONTH[] = { "", "JAN", "FEB", "MAR", "APR", "MAY", "JUN",
+	"JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };
+static const char* DOW[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+#define TZ_SUFFIX_MAX 31	// suffix codes are the control bytes 0x01-0x1f
+#define UNIX_EPOCH 946684800LL	// the clock's epoch, 1 JAN 2000, in unix seconds
+
+static const int MONTH_DAYS[] = { 0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+// convert one POSIX rule to the firmware's month/week/dow/day form
+static bool convertRule(const tzRule* r, int minutes, int* mon, int* week, int* dow, int* day, int* time) {
+	*time = minutes;
+	if (r->kind == 'M') {
+		*mon = r->month;
+		*week = r->week;
+		*dow = r->dow;
+		*day = 0;
+		if (r->week == 5) {
+			// "last" becomes week 0 of the following month
+			if (r->month == 12) return false;
+			*mon = r->month + 1;
+			*week = 0;
+		}
+		return true;
+	}
+	if (r->kind == 'J') {
+		int d = r->day;
+		for (*mon = 1; d > MONTH_DAYS[*mon]; (*mon)++) d -= MONTH_DAYS[*mon];
+		*week = 0;
+		*dow = 0;
+		*day = d;
+		return true;
+	}
+	return false;
+}
+
+// shared endings, each stored once and referenced by a code byte; an ending may itself
+// end in a code, so " Standard Time" is " Standard" followed by the code for " Time"
+static std::vector<std::string> suffixes;
+
+// repeatedly pick the word-boundary ending that saves the most flash
+static void chooseSuffixes(std::vector<std::string>* names) {
+	while (suffixes.size() < TZ_SUFFIX_MAX) {
+		std::string best;
+		long bestGain = 0;
+		for (size_t n = 0; n < names->size(); n++) {
+			const std::string& s = (*names)[n];
+			for (size_t at = s.find(' '); at != std::string::npos; at = s.find(' ', at + 1)) {
+				std::string tail = s.substr(at);
+				long count = 0;
+				for (size_t m = 0; m < names->size(); m++) {
+					const std::string& o = (*names)[m];
+					if (o.size() > tail.size() && o.compare(o.size() - tail.size(), tail.size(), tail) == 0) count++;
+				}
+				// each use saves the tail less its code byte; the tail costs itself plus a NUL and an offset
+				long gain = count * ((long)tail.size() - 1) - ((long)tail.size() + 3);
+				if (gain > bestGain || (gain == bestGain && gain > 0 && tail.size() > best.size())) {
+					best = tail;
+					bestGain = gain;
+				}
+			}
+		}
+		if (bestGain <= 0) break;
+		suffixes.push_back(best);
+		char code = (char)suffixes.size();
+		for (size_t n = 0; n < names->size(); n++) {
+			std::string& o = (*names)[n];
+			if (o.size() > best.size() && o.compare(o.size() - best.size(), best.size(), best) == 0) {
+				o.replace(o.size() - best.size(), best.size(), 1, code);
+			}
+		}
+	}
+}
+
+static std::string quote(const std::string& s) {
+	std::string q;
+	char esc[8];
+	for (size_t i = 0; i < s.size(); i++) {
+		unsigned char c = s[i];
+		if (c < ' ' || c >= 0x7f || c == '"' || c == '\\') {
+			snprintf(esc, sizeof(esc), "\\%03o", c);
+			q += esc;
+		}
+		else q += (char)c;
+	}
+	return q;
+}
+
+// pack the names, abbreviations and suffixes into one NUL-separated pool, storing
+// any string that is the tail of one already placed as an offset into it
+static void emitPool(const std::vector<zoneEntry>& zones) {
+	std::vector<std::string> strings;
+	for (size_t z = 0; z < zones.size(); z++) strings.push_back(zones[z].name);
+	chooseSuffixes(&strings);
+	size_t names = strings.size();
+	for (size_t z = 0; z < zones.size(); z++) strings.push_back(zones[z].abbr);
+	for (size_t s = 0; s < suffixes.size(); s++) strings.push_back(suffixes[s]);
+
+	// place the longest strings first so shorter ones can share their tails
+	std::vector<size_t> order(strings.size());
+	for (size_t s = 0; s < order.size(); s++) order[s] = s;
+	std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+		return strings[a].size() > strings[b].size();
+	});
+	std::vector<size_t> offset(strings.size());
+	std::vector<size_t> placed;
+	std::string pool;
+	printf("// names, abbreviations and shared suffixes, NUL-separated; a byte below 0x20 ends\n"
+		"// a string with TZ_SUFFIX[byte - 1]\n");
+	printf("const char TZ_POOL[] PROGMEM =\n");
+	for (size_t i = 0; i < order.size(); i++) {
+		const std::string& s = strings[order[i]];
+		size_t p;
+		for (p = 0; p < placed.size(); p++) {
+			const std::string& o = strings[placed[p]];
+			if (o.size() >= s.size() && o.compare(o.size() - s.size(), s.size(), s) == 0) break;
+		}
+		if (p < placed.size()) {
+			offset[order[i]] = offset[placed[p]] + strings[placed[p]].size() - s.size();
+			continue;
+		}
+		offset[order[i]] = pool.size();
+		placed.push_back(order[i]);
+		printf("\t\"%s\\0\"\t// %zu\n", quote(s).c_str(), pool.size());
+		pool += s;
+		pool += '\0';
+	}
+	printf("\t;\t\t// %zu bytes\n\n", pool.size() + 1);
+
+	printf("const unsigned int TZ_SUFFIX[] PROGMEM = {\n");
+	for (size_t s = 0; s < suffixes.size(); s++) printf("\t%zu%s\t// \"%s\"\n", offset[names + zones.size() + s],
+		s + 1 < suffixes.size() ? "," : " };", quote(suffixes[s]).c_str());
+	printf("\n");
+
+	printf("const unsigned int TZ_NAME[] PROGMEM = {\n");
+	for (size_t z = 0; z < zones.size(); z++) printf("\t%zu%s\t// %s\n", offset[z], z + 1 < zones.size() ? "," : " };", zones[z].abbr.c_str());
+	printf("\n");
+
+	printf("const unsigned int TZ_LOC[] PROGMEM = {\n");
+	for (size_t z = 0; z < zones.size(); z++) printf("\t%zu%s\t// %s\n", offset[names + z], z + 1 < zones.size() ? "," : " };", zones[z].abbr.c_str());
+	printf("\n");
+}
+
+// walk the zoneinfo table from the epoch and keep the states its current rules (the
+// footer) don't reproduce; the last state kept is the first one they do, from which
+// on the firmware follows its rules
+static bool buildHistory(const tzZone* tz, std::vector<transition>* history) {
+	std::vector<transition> states;
+	tzState s;
+	for (int64_t t = UNIX_EPOCH; ; t = s.until) {
+		tzLookup(tz, t, &s);
+		if (states.empty() || states.back().offset != s.utoff || states.back().dst != s.isdst) {
+			transition tr = { (long)((t - UNIX_EPOCH) / 60), s.utoff, s.isdst };
+			// records hold whole minutes and seven-bit quarter-hour offsets
+			if ((t - UNIX_EPOCH) % 60 || s.utoff % 900 || s.utoff / 900 < -64 || s.utoff / 900 > 63) return false;
+			states.push_back(tr);
+		}
+		// past the end of the table the footer rules apply anyway
+		if (s.until == TZ_FOREVER || tz->times.empty() || s.until > tz->times.back()) break;
+	}
+
+	// the footer on its own, to find the earliest state from which on it agrees
+	tzZone rules;
+	rules.hasFooter = true;
+	rules.footer = tz->footer;
+	size_t k = states.size();
+	while (k > 0) {
+		const transition* tr = &states[k - 1];
+		int64_t t = UNIX_EPOCH + tr->minutes * 60LL;
+		tzLookup(&rules, t, &s);
+		if (s.utoff != tr->offset || s.isdst != tr->dst) break;
+		// ...and doesn't change before the table does
+		if (k < states.size() && s.until < UNIX_EPOCH + states[k].minutes * 60LL) break;
+		k--;
+	}
+	history->clear();
+	if (k > 0) history->assign(states.begin(), states.begin() + k + 1);
+	return true;
+}
+
+// one record per state: the gap in minutes since the previous state (the epoch for the
+// first) seven bits at a time, least significant first, the top bit set on all but the
+// last byte; then the offset in quarter hours in the low seven bits, 0x80 for DST
+static void emitHistory(const std::vector<zoneEntry>& zones) {
+	std::vector<size_t> start;
+	size_t size = 0;
+	printf("// each zone's UTC transitions from the epoch until its current rules took over (see\n"
+		"// stepZone() for the encoding); the last record of a zone is where the rules take\n"
+		"// over, and a zone with no records has followed them since the epoch\n");
+	printf("const byte TZ_TRANS[] PROGMEM = {\n");
+	for (size_t z = 0; z < zones.size(); z++) {
+		start.push_back(size);
+		const std::vector<transition>& h = zones[z].history;
+		long last = 0;
+		for (size_t i = 0; i < h.size(); i++) {
+			std::string bytes;
+			char hex[8];
+			unsigned long gap = h[i].minutes - last;
+			last = h[i].minutes;
+			do {
+				snprintf(hex, sizeof(hex), "0x%02lx, ", (gap & 0x7f) | (gap > 0x7f ? 0x80 : 0));
+				bytes += hex;
+				size++;
+				gap >>= 7;
+			} while (gap);
+			snprintf(hex, sizeof(hex), "0x%02x,", (h[i].offset / 900 & 0x7f) | (h[i].dst ? 0x80 : 0));
+			bytes += hex;
+			size++;
+
+			int year, month, day;
+			int64_t t = UNIX_EPOCH + h[i].minutes * 60LL;
+			tzCivilFromDays(t / 86400, &year, &month, &day);
+			int a = h[i].offset < 0 ? -h[i].offset : h[i].offset;
+			printf("\t%-30s// %s %04d-%02d-%02d %02d:%02dZ %c%02d:%02d%s\n", bytes.c_str(),
+				i ? "   " : zones[z].abbr.c_str(), year, month, day, (int)(t % 86400 / 3600), (int)(t % 3600 / 60),
+				h[i].offset < 0 ? '-' : '+', a / 3600, a / 60 % 60,
+				i + 1 == h.size() ? " rules" : h[i].dst ? " DST" : "");
+		}
+	}
+	start.push_back(size);
+	printf("\t0 };\t\t// %zu bytes\n\n", size + 1);
+
+	printf("// offset of each zone's first record in TZ_TRANS, and of the end\n");
+	printf("const unsigned int TZ_TRANS_AT[] PROGMEM = {\n");
+	for (size_t z = 0; z <= zones.size(); z++) {
+		printf("\t%zu%s\t// %s\n", start[z], z < zones.size() ? "," : " };", z < zones.size() ? zones[z].abbr.c_str() : "end");
+	}
+	printf("\n");
+}
+
+static bool sameRules(const ruleset* a, const ruleset* b) {
+	return a->smon == b->smon && a->sweek == b->sweek && a->sdow == b->sdow && a->sday == b->sday
+		&& a->stime == b->stime && a->fmon == b->fmon && a->fweek == b->fweek && a->fdow == b->fdow
+		&& a->fday == b->fday && a->ftime == b->ftime;
+}
+
+static std::string describe(int mon, int week, int dow, int day, int time) {
+	static const char* ORDINAL[] = { "last", "1st", "2nd", "3rd", "4th" };
+	char buf[64];
+	int t = time < 0 ? -time : time;
+	const char* sign = time < 0 ? "-" : "";
+	if (day) snprintf(buf, sizeof(buf), "%d %s %s%02d:%02d", day, MONTH[mon], sign, t / 60, t % 60);
+	else if (week == 0) snprintf(buf, sizeof(buf), "last %s of %s %s%02d:%02d", DOW[dow],
+		MONTH[mon == 1 ? 12 : mon - 1], sign, t / 60, t % 60);
+	else snprintf(buf, sizeof(buf), "%s %s of %s %s%02d:%02d", ORDINAL[week], DOW[dow], MONTH[mon],
+		sign, t / 60, t % 60);
+	return buf;
+}
+
+// read the next non-empty line, split on tabs
+static bool readFields(FILE* f, std::vector<std::string>* fields) {
+	char line[512];
+	while (fgets(line, sizeof(line), f)) {
+		line[strcspn(line, "\r\n")] = '\0';
+		if (!line[0]) continue;
+		fields->clear();
+		for (char* tok = strtok(line, "\t"); tok; tok = strtok(NULL, "\t")) fields->push_back(tok);
+		return true;
+	}
+	return false;
+}
+
+// tz.data separates the offset with a tab or a space; only the first two columns matter
+static void splitName(std::vector<std::string>* f) {
+	if (f->size() >= 2) {
+		std::string& name = (*f)[1];
+		size_t utc = name.rfind(" UTC");
+		if (f->size() == 2 && utc != std::string::npos) name.erase(utc);
+	}
+}
+
+int main(int argc, char** argv) {
+	const char* dir = "/usr/share/zoneinfo";
+	const char* tzPath = "tz.data";
+	const char* zonesPath = "zones.data";
+
+	int opt;
+	while ((opt = getopt(argc, argv, "d:t:z:")) != -1) {
+		switch (opt) {
+		case 'd': dir = optarg; break;
+		case 't': tzPath = optarg; break;
+		case 'z': zonesPath = optarg; break;
+		default:
+			fprintf(stderr, "usage: tzbuild [-d zoneinfo-dir] [-t tz.data] [-z zones.data]\n");
+			return 1;
+		}
+	}
+
+	FILE* tzFile = fopen(tzPath, "r");
+	FILE* zonesFile = fopen(zonesPath, "r");
+	if (!tzFile || !zonesFile) {
+		perror(!tzFile ? tzPath : zonesPath);
+		return 1;
+	}
+
+	std::vector<zoneEntry> zones;
+	std::vector<ruleset> rules(1);
+	rules[0].name = "NONE";
+	std::vector<std::string> tzFields, zoneFields;
+
+	// both files list the zones in the same order, so read them side by side
+	while (readFields(tzFile, &tzFields)) {
+		if (!readFields(zonesFile, &zoneFields) || zoneFields.size() < 2) {
+			fprintf(stderr, "tzbuild: %s ends before %s\n", zonesPath, tzPath);
+			return 1;
+		}
+		splitName(&tzFields);
+		zoneEntry z;
+		z.abbr = tzFields[0];
+		z.name = tzFields.size() > 1 ? tzFields[1] : tzFields[0];
+		z.zone = zoneFields[1];
+		z.ds = 0;
+		if (zoneFields[0] != z.abbr) {
+			fprintf(stderr, "tzbuild: %s has %s where %s has %s\n", zonesPath, zoneFields[0].c_str(),
+				tzPath, z.abbr.c_str());
+			return 1;
+		}
+
+		tzZone tz;
+		std::string path = std::string(dir) + "/" + z.zone;
+		if (!tzLoad(&tz, path.c_str()) || !tz.hasFooter) {
+			fprintf(stderr, "tzbuild: no current rules in %s\n", path.c_str());
+			return 1;
+		}
+		const tzPosix* p = &tz.footer;
+
+		// the firmware applies DST as one hour forward from the smaller offset
+		int32_t std = p->stdOff;
+		if (p->hasDst) {
+			int32_t save = p->dstOff - p->stdOff;
+			if (save == 3600 || save == -3600) {
+				ruleset r;
+				// the rule into the larger offset starts DST; each rule's time is wall
+				// time in the offset before it, so the one ending DST loses an hour
+				const tzRule* start = save > 0 ? &p->start : &p->end;
+				const tzRule* finish = save > 0 ? &p->end : &p->start;
+				if (save < 0) std = p->dstOff;
+				bool ok = convertRule(start, start->time / 60, &r.smon, &r.sweek, &r.sdow, &r.sday, &r.stime)
+					&& convertRule(finish, finish->time / 60 - 60, &r.fmon, &r.fweek, &r.fdow, &r.fday, &r.ftime);
+				if (ok) {
+					size_t ds;
+					for (ds = 1; ds < rules.size() && !sameRules(&rules[ds], &r); ds++);
+					if (ds == rules.size()) {
+						r.name = zoneFields.size() > 2 ? zoneFields[2] : z.abbr;
+						rules.push_back(r);
+					}
+					else if (zoneFields.size() > 2 && rules[ds].name != zoneFields[2]) {
+						fprintf(stderr, "tzbuild: %s names %s, already built as DS_%s\n", z.abbr.c_str(),
+							zoneFields[2].c_str(), rules[ds].name.c_str());
+					}
+					z.ds = ds;
+				}
+				else z.note = "rule not expressible";
+			}
+			else z.note = "DST is not one hour";
+			if (!z.note.empty()) fprintf(stderr, "tzbuild: %s (%s): %s, DST dropped\n", z.abbr.c_str(),
+				z.zone.c_str(), z.note.c_str());
+		}
+		z.hour = std / 3600;
+		z.minute = (std % 3600) / 60;
+		if (!buildHistory(&tz, &z.history)) {
+			fprintf(stderr, "tzbuild: %s (%s): history has a time or offset the records can't hold\n",
+				z.abbr.c_str(), z.zone.c_str());
+			return 1;
+		}
+		zones.push_back(z);
+	}
+	fclose(tzFile);
+	fclose(zonesFile);
+
+	printf("/* WorldClock: a multiple time-zone clock for a 16x2 display\n"
+		" * Copyright 2015, James Lyden <james@lyden.org>\n"
+		" * This code is licensed under the terms of the GNU General Public License.\n"
+		" * See COPYING, or refer to http://www.gnu.org/licenses, for further details.\n"
+		" *\n"
+		" * Generated by tzBuilder/tzbuild from tz.data, zones.data and zoneinfo; edit\n"
+		" * those and regenerate rather than editing this file.\n"
+		" *\n"
+		" * This header builds the data structures for timezone attributes, including:\n"
+		" *   TZ_<abbr> Timezone abbreviation for indexing the following arrays\n"
+		" *   TZ_POOL	Flash string pool holding every name below, suffixes shared\n"
+		" *   TZ_SUFFIX	Offsets into TZ_POOL of the shared suffixes\n"
+		" *   TZ_NAME	Offset into TZ_POOL of the proper name for that timezone\n"
+		" *   TZ_LOC		Offset into TZ_POOL of a representative location in that timezone\n"
+		" *   TZ_HOUR	Offset from UTC (hours)\n"
+		" *   TZ_MIN		Offset from UTC (minutes)\n"
+		" *   TZ_DST		Which daylight savings rules to apply to this timezone\n"
+		" *   TZ_TRANS	Flash records of each timezone's transitions before its current rules\n"
+		" *   TZ_TRANS_AT	Offset into TZ_TRANS of each timezone's first record\n"
+		" *   DS_<name>	Human-readable DST ruleset for indexing into the following arrays\n"
+		" *   DS_SMON	Numeric month when DST starts\n"
+		" *   DS_SWEEK	Week of the month when DST starts (0 for the last week of the previous month)\n"
+		" *   DS_SDOW	Numeric day of the week when DST starts\n"
+		" *   DS_FMON	Numeric month when DST finishes\n"
+		" *   DS_FWEEK	Week of the month when DST finishes\n"
+		" *   DS_FDOW	Numeric day of the week when DST finishes\n"
+		" *   DS_SDAY	Numeric day of the month when DST starts\n"
+		" *   DS_FDAY	Numeric day of the month when DST finishes\n"
+		" *   DS_STIME	Minutes past midnight (local standard time) when DST starts\n"
+		" *   DS_FTIME	Minutes past midnight (local standard time) when DST finishes\n"
+		" */\n\n");
+
+	printf("// timezone name macros\n#define TZ_ZULU\t0\n");
+	for (size_t z = 0; z < zones.size(); z++) printf("#define TZ_%s\t%zu\n", zones[z].abbr.c_str(), z);
+	printf("#define SZ_ZONES\t%zu\t// total number of timezones\n\n", zones.size());
+
+	emitPool(zones);
+
+	printf("const int TZ_HOUR[] PROGMEM = {\n");
+	for (size_t z = 0; z < zones.size(); z++) printf("\t%d%s\t// %s\n", zones[z].hour, z + 1 < zones.size() ? "," : " };", zones[z].abbr.c_str());
+	printf("\n");
+
+	printf("const int TZ_MIN[] PROGMEM = {\n");
+	for (size_t z = 0; z < zones.size(); z++) printf("\t%d%s\t// %s\n", zones[z].minute, z + 1 < zones.size() ? "," : " };", zones[z].abbr.c_str());
+	printf("\n");
+
+	printf("#define DS_NONE\t\t0\t// never trigger DST\n");
+	for (size_t ds = 1; ds < rules.size(); ds++) {
+		const ruleset* r = &rules[ds];
+		printf("#define DS_%s\t%zu\t// %s, %s\n", r->name.c_str(), ds,
+			describe(r->smon, r->sweek, r->sdow, r->sday, r->stime).c_str(),
+			describe(r->fmon, r->fweek, r->fdow, r->fday, r->ftime).c_str());
+	}
+	printf("#define SZ_DS\t\t%zu\t// total number of DST rulesets\n\n", rules.size());
+
+	printf("const byte TZ_DST[] PROGMEM = {\n");
+	for (size_t z = 0; z < zones.size(); z++) {
+		printf("\tDS_%s%s\t// %s", rules[zones[z].ds].name.c_str(), z + 1 < zones.size() ? "," : " };", zones[z].abbr.c_str());
+		if (!zones[z].note.empty()) printf(" (%s)", zones[z].note.c_str());
+		printf("\n");
+	}
+	printf("\n");
+
+	emitHistory(zones);
+
+	// one table per field, the first entry impossible so DS_NONE has no effect; constexpr
+	// so dstables.h can expand the rules at compile time
+	struct { const char* type; const char* name; int ruleset::*field; int none; const char* comment; } tables[] = {
+		{ "byte", "DS_SMON", &ruleset::smon, 99, "// the first entry in each DS_* table represent impossible values to ensure DS_NONE has no effect.\n" },
+		{ "byte", "DS_SWEEK", &ruleset::sweek, 99, "" },
+		{ "byte", "DS_SDOW", &ruleset::sdow, 99, "" },
+		{ "byte", "DS_FMON", &ruleset::fmon, 99, "" },
+		{ "byte", "DS_FWEEK", &ruleset::fweek, 99, "" },
+		{ "byte", "DS_FDOW", &ruleset::fdow, 99, "" },
+		{ "byte", "DS_SDAY", &ruleset::sday, 0, "// if day != 0, override week/day-of-week calculation\n" },
+		{ "byte", "DS_FDAY", &ruleset::fday, 0, "" },
+		{ "int", "DS_STIME", &ruleset::stime, 0, "// transition times, in minutes past midnight local standard time\n" },
+		{ "int", "DS_FTIME", &ruleset::ftime, 0, "" } };
+	for (size_t t = 0; t < sizeof(tables) / sizeof(tables[0]); t++) {
+		printf("%sconstexpr %s %s[] PROGMEM = {\n", tables[t].comment, tables[t].type, tables[t].name);
+		for (size_t ds = 0; ds < rules.size(); ds++) {
+			int v = ds ? rules[ds].*tables[t].field : tables[t].none;
+			printf("\t%d%s\t// %s\n", v, ds + 1 < rules.size() ? "," : " };", rules[ds].name.c_str());
+		}
+		if (t + 1 < sizeof(tables) / sizeof(tables[0])) printf("\n");
+	}
+	return 0;
+}
@@ -0,0 +1,264 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file reads compiled zoneinfo (TZif, RFC 8536) files: the transition
+ * table from the 64-bit data block, and the POSIX TZ footer that extends it.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "tzif.h"
+
+// CIVIL DATES (proleptic Gregorian, days relative to 1970-01-01)
+
+int64_t tzDaysFromCivil(int year, int month, int day) {
+	int64_t y = year - (month <= 2);
+	int64_t era = (y >= 0 ? y : y - 399) / 400;
+	int64_t yoe = y - era * 400;
+	int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+	int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + doe - 719468;
+}
+
+void tzCivilFromDays(int64_t days, int* year, int* month, int* day) {
+	days += 719468;
+	int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+	int64_t doe = days - era * 146097;
+	int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	int64_t mp = (5 * doy + 2) / 153;
+	*day = doy - (153 * mp + 2) / 5 + 1;
+	*month = mp < 10 ? mp + 3 : mp - 9;
+	*year = yoe + era * 400 + (*month <= 2);
+}
+
+static bool isLeapYear(int year) {
+	return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+// POSIX TZ STRINGS
+
+static const char* parseName(const char* s, std::string* name) {
+	const char* begin = s;
+	if (*s == '<') {
+		while (*s && *s != '>') s++;
+		if (*s != '>') return NULL;
+		name->assign(begin + 1, s - begin - 1);
+		return s + 1;
+	}
+	while (isalpha((unsigned char)*s)) s++;
+	if (s - begin < 3) return NULL;
+	name->assign(begin, s - begin);
+	return s;
+}
+
+// [+-]hh[:mm[:ss]], hours may run past 24 in rule times
+static const char* parseTime(const char* s, int32_t* secs) {
+	int sign = 1, part[3] = { 0, 0, 0 };
+	if (*s == '+' || *s == '-') sign = (*s++ == '-') ? -1 : 1;
+	if (!isdigit((unsigned char)*s)) return NULL;
+	for (int p = 0; p < 3; p++) {
+		part[p] = strtol(s, (char**)&s, 10);
+		if (*s != ':' || p == 2) break;
+		s++;
+	}
+	*secs = sign * (part[0] * 3600 + part[1] * 60 + part[2]);
+	return s;
+}
+
+static const char* parseRule(const char* s, tzRule* rule) {
+	rule->time = 7200;
+	if (*s == 'M') {
+		rule->kind = 'M';
+		rule->month = strtol(s + 1, (char**)&s, 10);
+		if (*s++ != '.') return NULL;
+		rule->week = strtol(s, (char**)&s, 10);
+		if (*s++ != '.') return NULL;
+		rule->dow = strtol(s, (char**)&s, 10);
+	}
+	else if (*s == 'J') {
+		rule->kind = 'J';
+		rule->day = strtol(s + 1, (char**)&s, 10);
+	}
+	else if (isdigit((unsigned char)*s)) {
+		rule->kind = 'N';
+		rule->day = strtol(s, (char**)&s, 10);
+	}
+	else return NULL;
+
+	if (*s == '/') s = parseTime(s + 1, &rule->time);
+	return s;
+}
+
+bool tzParsePosix(tzPosix* posix, const char* s) {
+	int32_t off;
+
+	if (!(s = parseName(s, &posix->stdName))) return false;
+	if (!(s = parseTime(s, &off))) return false;
+	// POSIX offsets count hours west of UTC
+	posix->stdOff = -off;
+	posix->dstOff = posix->stdOff + 3600;
+	posix->hasDst = false;
+	if (!*s) return true;
+
+	if (!(s = parseName(s, &posix->dstName))) return false;
+	posix->hasDst = true;
+	if (*s && *s != ',') {
+		if (!(s = parseTime(s, &off))) return false;
+		posix->dstOff = -off;
+	}
+	if (*s++ != ',') return false;
+	if (!(s = parseRule(s, &posix->start))) return false;
+	if (*s++ != ',') return false;
+	if (!(s = parseRule(s, &posix->end))) return false;
+	return *s == '\0';
+}
+
+// UTC instant a rule fires in the provided year, given the offset in effect
+// just before it
+int64_t tzRuleTime(const tzRule* rule, int year, int32_t offset) {
+	int64_t days;
+
+	if (rule->kind == 'M') {
+		int64_t first = tzDaysFromCivil(year, rule->month, 1);
+		int firstDow = (int)(((first + 4) % 7 + 7) % 7);		// 1970-01-01 was a Thursday
+		days = first + (rule->dow - firstDow + 7) % 7 + 7 * (rule->week - 1);
+		// week 5 means the last one in the month
+		int next = rule->month == 12 ? 1 : rule->month + 1;
+		int64_t end = tzDaysFromCivil(rule->month == 12 ? year + 1 : year, next, 1);
+		while (days >= end) days -= 7;
+	}
+	else if (rule->kind == 'J') {
+		// Julian days 1-365 never count 29 FEB
+		days = tzDaysFromCivil(year, 1, 1) + rule->day - 1;
+		if (isLeapYear(year) && rule->day >= 60) days++;
+	}
+	else days = tzDaysFromCivil(year, 1, 1) + rule->day;
+
+	return days * 86400 + rule->time - offset;
+}
+
+static void posixLookup(const tzPosix* posix, int64_t t, tzState* state) {
+	state->utoff = posix->stdOff;
+	state->isdst = false;
+	state->until = TZ_FOREVER;
+	if (!posix->hasDst) return;
+
+	int year, month, day;
+	tzCivilFromDays((t + posix->stdOff) / 86400 - ((t + posix->stdOff) % 86400 < 0), &year, &month, &day);
+
+	// check the neighbouring years too, so instants near New Year land correctly
+	int64_t change[6];
+	bool dst[6];
+	for (int y = 0; y < 3; y++) {
+		change[2 * y] = tzRuleTime(&posix->start, year - 1 + y, posix->stdOff);
+		dst[2 * y] = true;
+		change[2 * y + 1] = tzRuleTime(&posix->end, year - 1 + y, posix->dstOff);
+		dst[2 * y + 1] = false;
+	}
+
+	// the state at t comes from the latest change at or before it
+	int64_t latest = INT64_MIN;
+	for (int c = 0; c < 6; c++) {
+		if (change[c] <= t && change[c] > latest) {
+			latest = change[c];
+			state->isdst = dst[c];
+		}
+		if (change[c] > t && change[c] < state->until) state->until = change[c];
+	}
+	if (state->isdst) state->utoff = posix->dstOff;
+}
+
+// TZIF FILES
+
+static int64_t beInt(const unsigned char* p, int len) {
+	uint64_t v = 0;
+	for (int i = 0; i < len; i++) v = (v << 8) | p[i];
+	// sign-extend 32-bit values
+	if (len == 4) return (int32_t)v;
+	return (int64_t)v;
+}
+
+bool tzLoad(tzZone* zone, const char* path) {
+	FILE* f = fopen(path, "rb");
+	if (!f) return false;
+	std::vector<unsigned char> buf;
+	unsigned char chunk[4096];
+	size_t n;
+	while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) buf.insert(buf.end(), chunk, chunk + n);
+	fclose(f);
+
+	const unsigned char* p = buf.data();
+	const unsigned char* end = p + buf.size();
+	if (buf.size() < 44 || memcmp(p, "TZif", 4) != 0) return false;
+	int version = p[4];
+
+	// skip the 32-bit block when a 64-bit one follows it
+	int timeLen = 4;
+	for (int pass = 0; pass < 2; pass++) {
+		if (end - p < 44 || memcmp(p, "TZif", 4) != 0) return false;
+		int64_t isut = beInt(p + 20, 4), isstd = beInt(p + 24, 4), leap = beInt(p + 28, 4);
+		int64_t timecnt = beInt(p + 32, 4), typecnt = beInt(p + 36, 4), charcnt = beInt(p + 40, 4);
+		p += 44;
+		size_t size = timecnt * timeLen + timecnt + typecnt * 6 + charcnt + leap * (timeLen + 4) + isstd + isut;
+		if ((size_t)(end - p) < size) return false;
+
+		if (version >= '2' && pass == 0) {
+			p += size;
+			timeLen = 8;
+			continue;
+		}
+
+		zone->times.resize(timecnt);
+		zone->types.resize(timecnt);
+		for (int64_t i = 0; i < timecnt; i++) zone->times[i] = beInt(p + i * timeLen, timeLen);
+		p += timecnt * timeLen;
+		for (int64_t i = 0; i < timecnt; i++) zone->types[i] = p[i];
+		p += timecnt;
+
+		const unsigned char* chars = p + typecnt * 6;
+		zone->info.resize(typecnt);
+		for (int64_t i = 0; i < typecnt; i++) {
+			zone->info[i].utoff = beInt(p + i * 6, 4);
+			zone->info[i].isdst = p[i * 6 + 4];
+			int idx = p[i * 6 + 5];
+			zone->info[i].abbr = idx < charcnt ? (const char*)chars + idx : "";
+		}
+		p += size - timecnt * timeLen - timecnt;
+		break;
+	}
+	if (zone->info.empty()) return false;
+
+	// the footer sits between two newlines at the end of the file
+	zone->hasFooter = false;
+	if (version >= '2' && p < end && *p == '\n') {
+		const unsigned char* nl = (const unsigned char*)memchr(p + 1, '\n', end - p - 1);
+		if (nl && nl > p + 1) {
+			std::string tz((const char*)p + 1, nl - p - 1);
+			zone->hasFooter = tzParsePosix(&zone->footer, tz.c_str());
+		}
+	}
+	return true;
+}
+
+void tzLookup(const tzZone* zone, int64_t t, tzState* state) {
+	const std::vector<int64_t>& times = zone->times;
+
+	// past the table, the footer rules (if any) take over
+	if (zone->hasFooter && (times.empty() || t >= times.back())) {
+		posixLookup(&zone->footer, t, state);
+		return;
+	}
+
+	size_t next = std::upper_bound(times.begin(), times.end(), t) - times.begin();
+	const tzType* type = &zone->info[next ? zone->types[next - 1] : 0];
+	state->utoff = type->utoff;
+	state->isdst = type->isdst;
+	if (next < times.size()) state->until = times[next];
+	else state->until = TZ_FOREVER;
+}
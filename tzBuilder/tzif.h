@@ -0,0 +1,59 @@
+/* WorldClock: a multiple time-zone clock for a 16x2 display
+ * Copyright 2015, James Lyden <james@lyden.org>
+ * This code is licensed under the terms of the GNU General Public License.
+ * See COPYING, or refer to http://www.gnu.org/licenses, for further details.
+ *
+ * This file declares a small reader for compiled zoneinfo (TZif) files, which
+ * tzBuilder generates timezones.h from. It shares no code with the sketch on
+ * purpose; tzsweep checks the result through the C library instead.
+ */
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#define TZ_FOREVER	INT64_MAX
+
+// one rule of a POSIX TZ string: Mm.w.d, Jn or n, plus local time of day
+struct tzRule {
+	char kind;							// 'M', 'J' or 'N' (zero-based day of year)
+	int month, week, dow, day;
+	int32_t time;						// seconds after local midnight
+};
+
+// the POSIX TZ string from the footer, which covers times after the table
+struct tzPosix {
+	std::string stdName, dstName;
+	int32_t stdOff, dstOff;			// seconds east of UTC
+	bool hasDst;
+	tzRule start, end;
+};
+
+// a local time type from the table
+struct tzType {
+	int32_t utoff;
+	bool isdst;
+	std::string abbr;
+};
+
+struct tzZone {
+	std::vector<int64_t> times;		// UTC transition instants (unix seconds)
+	std::vector<uint8_t> types;		// type in effect from each transition
+	std::vector<tzType> info;
+	bool hasFooter;
+	tzPosix footer;
+};
+
+// offset in effect at an instant, and how long it lasts
+struct tzState {
+	int32_t utoff;
+	bool isdst;
+	int64_t until;						// first instant with a different state
+};
+
+bool tzLoad(tzZone* zone, const char* path);
+bool tzParsePosix(tzPosix* posix, const char* str);
+void tzLookup(const tzZone* zone, int64_t t, tzState* state);
+int64_t tzRuleTime(const tzRule* rule, int year, int32_t offset);
+int64_t tzDaysFromCivil(int year, int month, int day);
+void tzCivilFromDays(int64_t days, int* year, int* month, int* day);